@@ -0,0 +1,46 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include <cstddef>
+# include <cstdio>
+# include <cstdlib>
+# include <ctime>
+
+/**
+ * Helpers shared by the benchmarks: each one prints a line per measure, the time
+ * in milliseconds followed by what it measures.
+ */
+
+//the results are added to this so that the compiler cannot drop the work measured
+static volatile size_t	g_sink = 0;
+
+//monotonic time, in seconds
+inline double	now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+inline void	report(const char *name, double seconds, const char *detail = "")
+{
+	std::printf("%-40s %10.2f ms  %s\n", name, seconds * 1000, detail);
+}
+
+//the number of elements given as first argument, or def
+inline size_t	argSize(int argc, char **argv, size_t def)
+{
+	if (argc > 1)
+		return (std::strtoul(argv[1], NULL, 10));
+	return (def);
+}
+
+//pseudo-random sequence, the same on every run
+inline size_t	nextRandom(size_t &state)
+{
+	state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return (state >> 33);
+}
+
+#endif
@@ -0,0 +1,43 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+
+/**
+ * Memory against time of the growth policies: n push_back of an int into an empty
+ * ft::vector, with the number of reallocations and the bytes held at the end.
+ *
+ * ./growth [n]
+ */
+template <class Growth>
+static void	fill(const char *name, size_t n)
+{
+	ft::vector<int, std::allocator<int>, Growth>	v;
+	size_t											reallocations = 0;
+	size_t											capacity = 0;
+	double											start = now();
+	char											detail[128];
+
+	for (size_t i = 0; i < n; i++)
+	{
+		v.push_back((int)i);
+		if (v.capacity() != capacity)
+		{
+			capacity = v.capacity();
+			reallocations++;
+		}
+	}
+	g_sink += v[n / 2];
+	std::snprintf(detail, sizeof(detail), "%lu reallocations, %lu bytes held, %.0f%% unused", (unsigned long)reallocations,
+		(unsigned long)v.memory_usage(), 100.0 * (v.capacity() - v.size()) / v.capacity());
+	report(name, now() - start, detail);
+}
+
+int	main(int argc, char **argv)
+{
+	size_t	n = argSize(argc, argv, 10000000);
+
+	fill<ft::grow_double>("grow_double", n);
+	fill<ft::grow_half>("grow_half", n);
+	fill<ft::grow_size_class>("grow_size_class", n);
+	fill<ft::grow_chunk<4096> >("grow_chunk<4096>", n < 1000000 ? n : 1000000);
+	return (0);
+}
@@ -0,0 +1,108 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../vector/hugePageAllocator.hpp"
+#include <cstring>
+#ifdef __linux__
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+/**
+ * Sequential and random scans of an ft::vector<double> of n elements, backed by
+ * std::allocator or by ft::huge_page_allocator, with the data TLB misses of each scan.
+ *
+ * The misses are read from the perf counters: where they are not available (not Linux,
+ * perf_event_paranoid, no hardware counter) only the times are printed.
+ *
+ * ./huge_pages [n]
+ */
+
+//data TLB read misses of the calling thread, or -1 without perf counters
+class	tlbCounter
+{
+	private:
+		int	_fd;
+
+	public:
+		tlbCounter(void): _fd(-1)
+		{
+#ifdef __linux__
+			struct perf_event_attr	attr;
+
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			this->_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+		}
+
+		~tlbCounter(void)
+		{
+			if (this->_fd >= 0)
+				close(this->_fd);
+		}
+
+		long long	read(void) const
+		{
+			long long	count = -1;
+
+			if (this->_fd < 0 || ::read(this->_fd, &count, sizeof(count)) != sizeof(count))
+				return (-1);
+			return (count);
+		}
+};
+
+static void	measure(const char *name, const tlbCounter &tlb, double start, long long misses)
+{
+	double		end = now();
+	long long	after = tlb.read();
+	char		detail[64] = "";
+
+	if (misses >= 0 && after >= 0)
+		std::snprintf(detail, sizeof(detail), "%lld dTLB misses", after - misses);
+	report(name, end - start, detail);
+}
+
+template <class Alloc>
+static void	scans(const char *name, size_t n, const size_t *order, const tlbCounter &tlb)
+{
+	ft::vector<double, Alloc>	v(n, 1.0);
+	double						sum = 0;
+	double						start;
+	long long					misses;
+	char						label[64];
+
+	misses = tlb.read();
+	start = now();
+	for (size_t i = 0; i < n; i++)
+		sum += v[i];
+	std::snprintf(label, sizeof(label), "%s: sequential", name);
+	measure(label, tlb, start, misses);
+	misses = tlb.read();
+	start = now();
+	for (size_t i = 0; i < n; i++)
+		sum += v[order[i]];
+	std::snprintf(label, sizeof(label), "%s: random", name);
+	measure(label, tlb, start, misses);
+	g_sink += (size_t)sum;
+}
+
+int	main(int argc, char **argv)
+{
+	size_t				n = argSize(argc, argv, 32 * 1024 * 1024);
+	ft::vector<size_t>	order(n);
+	size_t				state = 42;
+	tlbCounter			tlb;
+
+	for (size_t i = 0; i < n; i++)
+		order[i] = nextRandom(state) % n;
+	if (tlb.read() < 0)
+		std::printf("no perf counters: times only\n");
+	scans<std::allocator<double> >("std::allocator", n, &order[0], tlb);
+	scans<ft::huge_page_allocator<double> >("huge_page_allocator", n, &order[0], tlb);
+	return (0);
+}
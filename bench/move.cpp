@@ -0,0 +1,33 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include <string>
+
+/**
+ * Growth of an ft::vector<std::string>: n push_back of strings too long for the small
+ * string buffer, so that every relocation by copy allocates. Built once per language
+ * mode: in C++11 the strings are moved when the vector reallocates.
+ *
+ * ./move_cxx98 [n] / ./move_cxx11 [n]
+ */
+int	main(int argc, char **argv)
+{
+	size_t					n = argSize(argc, argv, 2000000);
+	std::string				s(40, 'x');
+	ft::vector<std::string>	v;
+	double					start;
+
+#if __cplusplus >= 201103L
+	const char	*mode = "C++11";
+#else
+	const char	*mode = "C++98";
+#endif
+	start = now();
+	for (size_t i = 0; i < n; i++)
+		v.push_back(s);
+	report("push_back", now() - start, mode);
+	start = now();
+	v.insert(v.begin(), s);
+	report("insert at the front", now() - start, mode);
+	g_sink += v.size();
+	return (0);
+}
@@ -0,0 +1,65 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../vector/setAlgorithms.hpp"
+#include <algorithm>
+
+/**
+ * Set operations on sorted ft::vector<unsigned int> posting lists, against the same
+ * calls of <algorithm>: lists of n elements, and a list of n / 64 against one of n.
+ *
+ * ./set_algorithms [n]
+ */
+
+static const int	ROUNDS = 20;
+
+//strictly increasing list of n values, about one in density of the integers
+static ft::vector<unsigned int>	postings(size_t n, size_t density, size_t seed)
+{
+	ft::vector<unsigned int>	v(n);
+	unsigned int				x = 0;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		x += 1 + nextRandom(seed) % (2 * density - 1);
+		v[i] = x;
+	}
+	return (v);
+}
+
+typedef ft::vector<unsigned int>::iterator	iterator;
+typedef unsigned int						*(*setOperation)(iterator, iterator, iterator, iterator, unsigned int *);
+
+static void	run(const char *name, setOperation op, ft::vector<unsigned int> &a, ft::vector<unsigned int> &b)
+{
+	ft::vector<unsigned int>	out(a.size() + b.size());
+	double						start = now();
+	size_t						written = 0;
+	char						detail[64];
+
+	for (int r = 0; r < ROUNDS; r++)
+		written = op(a.begin(), a.end(), b.begin(), b.end(), &out[0]) - &out[0];
+	g_sink += written;
+	std::snprintf(detail, sizeof(detail), "%lu elements out, %d rounds", (unsigned long)written, ROUNDS);
+	report(name, now() - start, detail);
+}
+
+int	main(int argc, char **argv)
+{
+	size_t						n = argSize(argc, argv, 1000000);
+	ft::vector<unsigned int>	a = postings(n, 4, 1);
+	ft::vector<unsigned int>	b = postings(n, 4, 2);
+	ft::vector<unsigned int>	small = postings(n / 64, 256, 3);
+
+	run("std::set_intersection", &std::set_intersection<iterator, iterator, unsigned int *>, a, b);
+	run("ft::set_intersection", &ft::set_intersection<iterator, iterator, unsigned int *>, a, b);
+	run("ft::set_intersection_unique (SSE2)", &ft::set_intersection_unique<iterator, iterator, unsigned int *>, a, b);
+	run("(skewed) std::set_intersection", &std::set_intersection<iterator, iterator, unsigned int *>, small, a);
+	run("(skewed) ft::set_intersection", &ft::set_intersection<iterator, iterator, unsigned int *>, small, a);
+	run("std::set_union", &std::set_union<iterator, iterator, unsigned int *>, a, b);
+	run("ft::set_union", &ft::set_union<iterator, iterator, unsigned int *>, a, b);
+	run("std::set_difference", &std::set_difference<iterator, iterator, unsigned int *>, a, b);
+	run("ft::set_difference", &ft::set_difference<iterator, iterator, unsigned int *>, a, b);
+	run("std::merge", &std::merge<iterator, iterator, unsigned int *>, a, b);
+	run("ft::merge", &ft::merge<iterator, iterator, unsigned int *>, a, b);
+	return (0);
+}
@@ -0,0 +1,57 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../vector/smallVector.hpp"
+#include <new>
+
+/**
+ * Per-request vectors of fewer than 8 elements: heap allocations per request and time,
+ * for ft::vector against ft::small_vector<int, 8>.
+ *
+ * ./small_vector [requests]
+ */
+
+static size_t	g_allocations = 0;
+
+void	*operator new(size_t size) throw(std::bad_alloc)
+{
+	void	*p;
+
+	g_allocations++;
+	p = std::malloc(size ? size : 1);
+	if (p == NULL)
+		throw std::bad_alloc();
+	return (p);
+}
+
+void	operator delete(void *p) throw()
+{
+	std::free(p);
+}
+
+template <class Vector>
+static void	requests(const char *name, size_t n)
+{
+	size_t	allocations = g_allocations;
+	double	start = now();
+	char	detail[64];
+
+	for (size_t i = 0; i < n; i++)
+	{
+		Vector	v;
+
+		for (size_t k = 0; k < i % 8; k++)
+			v.push_back((int)k);
+		g_sink += v.size();
+	}
+	std::snprintf(detail, sizeof(detail), "%.2f allocations per request", (double)(g_allocations - allocations) / n);
+	report(name, now() - start, detail);
+}
+
+int	main(int argc, char **argv)
+{
+	size_t	n = argSize(argc, argv, 10000000);
+
+	requests<ft::vector<int> >("vector<int>", n);
+	requests<ft::small_vector<int, 8> >("small_vector<int, 8>", n);
+	return (0);
+}
@@ -0,0 +1,54 @@
+#include "bench.hpp"
+#include "../map/mapSnapshot.hpp"
+#include <vector>
+#include <unistd.h>
+
+/**
+ * Startup of a table of n entries: rebuilding an ft::map from the pairs against
+ * mapping a snapshot with ft::map_view, then the same lookups through both.
+ *
+ * ./snapshot [n]
+ */
+int	main(int argc, char **argv)
+{
+	size_t								n = argSize(argc, argv, 1000000);
+	std::vector<ft::pair<int, double> >	pairs;
+	ft::map<int, double>				m;
+	char								path[] = "/tmp/ft_bench_snapshotXXXXXX";
+	int									fd = mkstemp(path);
+	size_t								state = 42;
+	double								start;
+
+	if (fd < 0)
+		return (1);
+	close(fd);
+	for (size_t i = 0; i < n; i++)
+		pairs.push_back(ft::pair<int, double>((int)nextRandom(state), i * 0.5));
+
+	start = now();
+	m.insert(pairs.begin(), pairs.end());
+	report("map: insert every entry", now() - start);
+	start = now();
+	ft::write_snapshot(m, path);
+	report("write_snapshot", now() - start);
+	{
+		start = now();
+		ft::map_view<int, double>	view(path);
+		report("map_view: open", now() - start);
+
+		start = now();
+		for (size_t i = 0; i < n; i++)
+			g_sink += m.count(pairs[i].first);
+		report("map: find every key", now() - start);
+		start = now();
+		for (size_t i = 0; i < n; i++)
+			g_sink += view.count(pairs[i].first);
+		report("map_view: find every key", now() - start);
+		start = now();
+		for (ft::map_view<int, double>::const_iterator it = view.begin(); it != view.end(); ++it)
+			g_sink += (size_t)it->second;
+		report("map_view: iterate", now() - start);
+	}
+	unlink(path);
+	return (0);
+}
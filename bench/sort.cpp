@@ -0,0 +1,75 @@
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../vector/sort.hpp"
+#include "../vector/parallel.hpp"
+#include <algorithm>
+
+/**
+ * Sorts of n random ints (radix sorted by ft) and n random doubles (introsort), against
+ * std::sort and std::stable_sort. The parallel sorts run on a pool of the given number of
+ * threads, one per processor by default.
+ *
+ * ./sort [n] [threads]
+ */
+
+static ft::parallel::thread_pool	*g_pool = NULL;
+
+template <class T>
+struct	sorts
+{
+	typedef typename ft::vector<T>::iterator	iterator;
+	typedef void								(*sorter)(iterator, iterator);
+
+	static void	stdSort(iterator first, iterator last) { std::sort(first, last); }
+	static void	stdStableSort(iterator first, iterator last) { std::stable_sort(first, last); }
+	static void	ftSort(iterator first, iterator last) { ft::sort(first, last); }
+	static void	ftStableSort(iterator first, iterator last) { ft::stable_sort(first, last); }
+	static void	parallelSort(iterator first, iterator last) { ft::parallel::sort(*g_pool, first, last); }
+	static void	parallelStableSort(iterator first, iterator last) { ft::parallel::stable_sort(*g_pool, first, last); }
+
+	static void	run(const char *name, sorter sort, const ft::vector<T> &input)
+	{
+		ft::vector<T>	v(input);
+		double			start = now();
+		double			seconds;
+		bool			sorted = true;
+
+		sort(v.begin(), v.end());
+		seconds = now() - start;
+		for (size_t i = 1; i < v.size(); i++)
+			sorted = sorted && !(v[i] < v[i - 1]);
+		report(name, seconds, sorted ? "" : "NOT SORTED");
+		g_sink += v.size();
+	}
+
+	static void	all(const char *type, const ft::vector<T> &input)
+	{
+		std::printf("%s\n", type);
+		run("  std::sort", &stdSort, input);
+		run("  ft::sort", &ftSort, input);
+		run("  ft::parallel::sort", &parallelSort, input);
+		run("  std::stable_sort", &stdStableSort, input);
+		run("  ft::stable_sort", &ftStableSort, input);
+		run("  ft::parallel::stable_sort", &parallelStableSort, input);
+	}
+};
+
+int	main(int argc, char **argv)
+{
+	size_t						n = argSize(argc, argv, 10000000);
+	ft::parallel::thread_pool	pool(argc > 2 ? std::strtoul(argv[2], NULL, 10) : 0);
+	ft::vector<int>				ints(n);
+	ft::vector<double>			doubles(n);
+	size_t						state = 42;
+
+	g_pool = &pool;
+	for (size_t i = 0; i < n; i++)
+	{
+		ints[i] = (int)nextRandom(state);
+		doubles[i] = nextRandom(state) / 3.0;
+	}
+	std::printf("%lu elements, %lu threads\n", (unsigned long)n, (unsigned long)pool.size());
+	sorts<int>::all("int", ints);
+	sorts<double>::all("double", doubles);
+	return (0);
+}
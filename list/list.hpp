@@ -105,6 +105,24 @@ namespace	ft
 				assign(x.begin(), x.end());
 			}
 
+# if FT_CXX11
+			/**
+			 * Move constructor.
+			 *
+			 * Takes the nodes of x, which is left empty.
+			 * @x : Another list object of the same type.
+			 */
+			list (list&& x) : _c_value_allocator(x._c_value_allocator)
+			{
+				this->_c_node = this->_c_node_allocator.allocate(1);
+				this->_c_value_allocator.construct(&this->_c_node->content, value_type());
+				this->_c_node->next = this->_c_node;
+				this->_c_node->previous = this->_c_node;
+				this->_c_size = 0;
+				swap(x);
+			}
+# endif
+
 			/**
 			 * Destructor.
 			 */
@@ -128,6 +146,23 @@ namespace	ft
 				return (*this);
 			}
 
+# if FT_CXX11
+			/**
+			 * Move assignment: destroys the elements of the container, then takes the nodes of x.
+			 * @x : A list object of the same type.
+			 * @return : *this.
+			 */
+			list& operator= (list&& x)
+			{
+				if (this != &x)
+				{
+					clear();
+					swap(x);
+				}
+				return (*this);
+			}
+# endif
+
 			//ITERATORS
 
 			/**
@@ -400,6 +435,38 @@ namespace	ft
 				this->_c_size++;
 			}
 
+# if FT_CXX11
+			void push_front (value_type&& val)
+			{
+				emplace(begin(), FT_MOVE(val));
+			}
+
+			void push_back (value_type&& val)
+			{
+				emplace(end(), FT_MOVE(val));
+			}
+
+			/**
+			 * Construct and insert element at beginning.
+			 * @args : Arguments forwarded to the constructor of the new element.
+			 */
+			template <class... Args>
+			void emplace_front (Args&&... args)
+			{
+				emplace(begin(), std::forward<Args>(args)...);
+			}
+
+			/**
+			 * Construct and insert element at the end.
+			 * @args : Arguments forwarded to the constructor of the new element.
+			 */
+			template <class... Args>
+			void emplace_back (Args&&... args)
+			{
+				emplace(end(), std::forward<Args>(args)...);
+			}
+# endif
+
 			/**
 			 * Delete last element.
 			 *
@@ -462,6 +529,46 @@ namespace	ft
 				return (ret);
 			}
 
+# if FT_CXX11
+			iterator insert (iterator position, value_type&& val)
+			{
+				return (emplace(position, FT_MOVE(val)));
+			}
+
+			/**
+			 * Construct and insert element.
+			 *
+			 * The element is constructed in its node, which is linked before position in constant time.
+			 * @position : Position in the container where the new element is inserted.
+			 * @args : Arguments forwarded to the constructor of the new element.
+			 * @return : an iterator to the inserted element.
+			 */
+			template <class... Args>
+			iterator emplace (iterator position, Args&&... args)
+			{
+				node<T>	*pos = reinterpret_cast<node<T> *>(&*position);
+				node<T>	*new_node;
+
+				new_node = this->_c_node_allocator.allocate(1);
+				try
+				{
+					this->_c_value_allocator.construct(&new_node->content, std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					this->_c_node_allocator.deallocate(new_node, 1);
+					throw ;
+				}
+
+				new_node->next = pos;
+				new_node->previous = pos->previous;
+				pos->previous->next = new_node;
+				pos->previous = new_node;
+				this->_c_size++;
+				return (iterator(new_node));
+			}
+# endif
+
 			/**
 			 * Insert elements. (fill)
 			 *
@@ -649,6 +756,12 @@ namespace	ft
 					splice(position, x, first++);
 			}
 
+# if FT_CXX11
+			void splice (iterator position, list&& x) { splice(position, x); }
+			void splice (iterator position, list&& x, iterator i) { splice(position, x, i); }
+			void splice (iterator position, list&& x, iterator first, iterator last) { splice(position, x, first, last); }
+# endif
+
 			/**
 			 * Remove elements with specific value.
 			 *
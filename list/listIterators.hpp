@@ -20,6 +20,7 @@ namespace	ft
 			typedef	T					*pointer;
 			typedef	T	const			*const_pointer;
 			typedef	std::ptrdiff_t		difference_type;
+			typedef	std::bidirectional_iterator_tag	iterator_category;
 
 		private:
 			node<T>	*_i_container;
@@ -146,6 +147,7 @@ namespace	ft
 			typedef	T					*pointer;
 			typedef	T	const			*const_pointer;
 			typedef	std::ptrdiff_t		difference_type;
+			typedef	std::bidirectional_iterator_tag	iterator_category;
 
 		private:
 			node<T>	*_i_container;
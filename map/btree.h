@@ -1,6 +1,7 @@
 #ifndef BTREE_H
 # define BTREE_H
 # include "pair.hpp"
+# include <cstddef>
 
 template < class Key, class T>
 struct btree
@@ -2,8 +2,13 @@
 # define MAP_HPP
 # include "mapIterators.hpp"
 # include "../reverse_iterator.hpp"
+# include "../utils.hpp"
+# include "mapStats.hpp"
 # include <iostream>
 # include <cstddef>
+# include <cstring>
+# include <algorithm>
+# include <new>
 
 namespace   ft
 {
@@ -17,7 +22,7 @@ namespace   ft
      * 
      * Maps are typically implemented as binary search trees.
      */
-    template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> >, class Stats = map_no_stats >
     class map
     {
         public:
@@ -42,7 +47,42 @@ namespace   ft
             size_type                           _c_size;
             allocator_type				        _c_value_allocator;
 			std::allocator<btree<const Key, T> >	    _c_node_allocator;
-			key_compare 						_cmp;
+			mutable mapCompare<Compare, Stats>	_cmp;
+
+			/**
+			 * Compares two keys with the comparison object of the map.
+			 *
+			 * Every key comparison goes through here so that it can be counted.
+			 */
+			bool	keyLess (const key_type &a, const key_type &b) const
+			{
+				this->_cmp.comparison();
+				return (this->_cmp.comp(a, b));
+			}
+
+			/**
+			 * Records a descent from the root that stopped at node.
+			 */
+			void	descentTo (const btree<const Key, T> *node) const
+			{
+				if (Stats::enabled)
+					this->_cmp.descent(depthOf(node));
+			}
+
+			/**
+			 * Returns the depth of node, the root of the tree being at depth 1.
+			 */
+			size_type	depthOf (const btree<const Key, T> *node) const
+			{
+				size_type	depth = 0;
+
+				while (node != NULL && node != this->_c_root)
+				{
+					node = node->previous;
+					++depth;
+				}
+				return (depth);
+			}
 
             /**
              * This function finds the node which in the ultimate left of the tree.
@@ -88,137 +128,206 @@ namespace   ft
 			}
 
             /**
-             * This function will delete a node wich have no child.
+             * This function replaces, in the parent of old_node, the link to old_node by a link to new_node.
              * 
-             * @tmp : the node to be deleted.
-             * @node : the parent of tmp.
-             */
-            void    deleteNodeWithNoChild (btree<const Key, T> *tmp)
-            {
-                if (tmp->previous == this->_c_root)               //need to delete root
-                {
-                    this->_c_root->left = NULL;
-                    this->_c_root->l_flag = false;
-                    this->_c_root->r_flag = false;
-                    this->_c_root->left = this->_c_root;
-                    this->_c_root->right = this->_c_root;
-                }
-                else if (tmp == tmp->previous->left)    //tmp is a left child
-                {
-					tmp->previous->l_flag = false;
-					tmp->previous->left = tmp->left;
-                    if (tmp->left == this->_c_root)
-                        this->_c_root->right = tmp->previous;
-                }
-                else                            //tmp is right child
-                {
-					tmp->previous->r_flag = false;
-					tmp->previous->right = tmp->right;
-                    if (tmp->right == this->_c_root)
-                        this->_c_root->left = tmp->previous;
-                }
-				this->_c_value_allocator.destroy(&tmp->element);
-				this->_c_node_allocator.deallocate(tmp, 1);
-            }
-
-            /**
-             * This function will delete a node wich have only a right child.
+             * The root of the tree is the right child of the dummy node, so it is handled like any other node.
              * 
-             * @tmp : the node to delete.
-             * @node : the parent of tmp.
+             * @old_node : the node to replace.
+             * @new_node : the node to put in its place.
              */
-            void    deleteNodeWithLeftChild (btree<const Key, T> *tmp)
+            void    replaceChild (btree<const Key, T> *old_node, btree<const Key, T> *new_node)
             {
-                if (tmp->previous == this->_c_root)   //the node to delete is the root of the tree.
-                {
-                	tmp->left->previous = this->_c_root;
-                    this->_c_root->right = tmp->left;
-                    return ;
-                }
-                if (tmp->previous->right == tmp)
-                    tmp->previous->right = tmp->left;
-                else
-                    tmp->previous->left = tmp->left;
+                btree<const Key, T>   *parent = old_node->previous;
 
-                tmp->left->previous = tmp->previous;
-				this->_c_value_allocator.destroy(&tmp->element);
-				this->_c_node_allocator.deallocate(tmp, 1);
+                if (parent->r_flag == true && parent->right == old_node)
+                    parent->right = new_node;
+                else
+                    parent->left = new_node;
             }
 
             /**
-             * This function will delete a node wich have only a left child.
+             * This function will unlink a node wich have at most one child from the tree.
              * 
-             * @tmp : the node to delete.
-             * @node : the parent of tmp.
+             * The child takes the place of tmp, and the thread of the subtree that pointed to tmp
+             * now points where tmp's own thread pointed.
+             * 
+             * @tmp : the node to unlink, it is neither destroyed nor deallocated.
              */
-            void    deleteNodeWithRightChild (btree<const Key, T> *tmp)
+            void    unlinkNode (btree<const Key, T> *tmp)
             {
-                if (tmp->previous == this->_c_root)   //the node to delete is the root of the tree.
+                btree<const Key, T>   *parent = tmp->previous;
+                btree<const Key, T>   *child;
+
+                if (tmp->r_flag == true)                    //tmp has only a right child.
                 {
-					tmp->right->previous = this->_c_root;
-					this->_c_root->right = tmp->right;
+                    child = tmp->right;
+                    leftNode(child)->left = tmp->left;
+                }
+                else if (tmp->l_flag == true)               //tmp has only a left child.
+                {
+                    child = tmp->left;
+                    rightNode(child)->right = tmp->right;
+                }
+                else                                        //tmp has no child.
+                {
+                    if (parent == this->_c_root)            //tmp was the last node of the tree.
+                        this->_c_root->right = this->_c_root;
+                    else if (parent->r_flag == true && parent->right == tmp)
+                    {
+                        parent->r_flag = false;
+                        parent->right = tmp->right;
+                    }
+                    else
+                    {
+                        parent->l_flag = false;
+                        parent->left = tmp->left;
+                    }
                     return ;
                 }
-                if (tmp->previous->left == tmp)
-                    tmp->previous->left = tmp->right;
-                else
-                    tmp->previous->right = tmp->right;
-
-                tmp->right->previous = tmp->previous;
-				this->_c_value_allocator.destroy(&tmp->element);
-				this->_c_node_allocator.deallocate(tmp, 1);
+                replaceChild(tmp, child);
+                child->previous = parent;
             }
 
             /**
-             * This function will a node wich have two children.
-             * 
-             * @tmp : the node to delete.
-             * @node : the parent of tmp.
+             * Destroys the element of an unlinked node and deallocates it.
              */
-            void    deleteNodeWithTwoChildren (btree<const Key, T> *tmp)
+            void    destroyNode (btree<const Key, T> *node)
             {
-                this->_c_value_allocator.destroy(&tmp->element);
-                this->_c_value_allocator.construct(&tmp->element, rightNode(tmp->left)->element);
-            	if (rightNode(tmp->left)->r_flag == false && rightNode(tmp->left)->l_flag == false)
-            		deleteNodeWithNoChild(rightNode(tmp->left));
-            	else if (rightNode(tmp->left)->r_flag == false)
-            		deleteNodeWithLeftChild(rightNode(tmp->left));
-            	else
-					deleteNodeWithRightChild(rightNode(tmp->left));
+                this->_c_value_allocator.destroy(&node->element);
+                this->_c_node_allocator.deallocate(node, 1);
+                this->_cmp.node_free();
             }
 
             /**
-             * This function will redirect to the most appropriate function to delete a node.
+             * This function will remove a node from the tree, destroy its element and deallocate it.
+             * 
+             * A node with two children is replaced by its inorder successor, which is moved rather than
+             * copied, so iterators to the other elements stay valid.
              * 
              * @tmp : the node to delete.
-             * @node : the parent of tmp.
              */
 			void    eraseElement (btree<const Key, T> *tmp)
             {
+                btree<const Key, T>   *next;
+
                 if (tmp->l_flag == true && tmp->r_flag == true) //tmp has two children.
-                    deleteNodeWithTwoChildren(tmp);
-                else if (tmp->l_flag == true)                   //tmp has only a left child.
-                    deleteNodeWithLeftChild(tmp);
-                else if (tmp->r_flag == true)                   //tmp has only a left child.
-                    deleteNodeWithRightChild(tmp);
-                else                                            //tmp has no child.
-                    deleteNodeWithNoChild(tmp);
+                {
+                    next = rightNode(tmp->left);
+                    unlinkNode(next);
+                    next->left = tmp->left;
+                    next->l_flag = tmp->l_flag;
+                    next->right = tmp->right;
+                    next->r_flag = true;
+                    next->previous = tmp->previous;
+                    replaceChild(tmp, next);
+                    next->right->previous = next;
+                    leftNode(next->right)->left = next;
+                    if (next->l_flag == true)
+                    {
+                        next->left->previous = next;
+                        rightNode(next->left)->right = next;
+                    }
+                }
+                else
+                    unlinkNode(tmp);
+                destroyNode(tmp);
 
                 //the size of the tree is decreased by one.
                 --this->_c_size;
             }
 
+			/**
+			 * Builds the mapped value of a node with its default constructor.
+			 */
+			struct	defaultBuilder
+			{
+				void	operator() (T *where) const { ::new (static_cast<void *>(where)) T(); }
+			};
+
+			/**
+			 * Builds the mapped value of a node from one constructor argument.
+			 */
+			template <class A1>
+			struct	argBuilder
+			{
+				const A1	&a1;
+
+				argBuilder (const A1 &a): a1(a) {}
+				void	operator() (T *where) const { ::new (static_cast<void *>(where)) T(a1); }
+			};
+
+			/**
+			 * Builds the mapped value of a node from two constructor arguments.
+			 */
+			template <class A1, class A2>
+			struct	argsBuilder
+			{
+				const A1	&a1;
+				const A2	&a2;
+
+				argsBuilder (const A1 &a, const A2 &b): a1(a), a2(b) {}
+				void	operator() (T *where) const { ::new (static_cast<void *>(where)) T(a1, a2); }
+			};
+
+# if FT_CXX11
+			/**
+			 * Builds the mapped value of a node by moving an existing one.
+			 */
+			struct	moveBuilder
+			{
+				T	&value;
+
+				moveBuilder (T &v): value(v) {}
+				void	operator() (T *where) const { ::new (static_cast<void *>(where)) T(FT_MOVE(value)); }
+			};
+# endif
+
+			/**
+			 * Allocates a node and constructs its element in place.
+			 *
+			 * The key is copied into the node and the mapped value is built directly
+			 * inside it by build, so no temporary pair is ever created.
+			 *
+			 * @k : the key of the new element.
+			 * @build : a builder constructing the mapped value at a given address.
+			 * @return : the new unlinked node.
+			 */
+			template <class Builder>
+			btree<const Key, T>	*createNode (const key_type &k, const Builder &build)
+			{
+				btree<const Key, T>	*node = this->_c_node_allocator.allocate(1);
+				Key					*key = const_cast<Key *>(&node->element.first);
+
+				this->_cmp.node_allocation();
+				::new (static_cast<void *>(key)) Key(k);
+				try
+				{
+					build(&node->element.second);
+				}
+				catch (...)
+				{
+					key->~Key();
+					this->_c_node_allocator.deallocate(node, 1);
+					this->_cmp.node_free();
+					throw;
+				}
+				node->previous = NULL;
+				node->right = NULL;
+				node->left = NULL;
+				node->r_flag = false;
+				node->l_flag = false;
+				return (node);
+			}
+
 			/**
 			 * Insert a node at the root of the tree.
 			 *
 			 * @param node : the new node.
-			 * @param val : the value inserted.
 			 * @return : a pair, with its member pair::first set to an iterator pointing to either the
 			 * newly inserted element or to the element with an equivalent key in the map.
 			 */
-            ft::pair<iterator, bool>	insertRoot (btree<const Key, T> *node, const value_type &val)
+            ft::pair<iterator, bool>	insertRoot (btree<const Key, T> *node)
 			{
-				this->_c_value_allocator.construct(&node->element, val);
 				node->right = this->_c_root->right;
 				node->l_flag = this->_c_root->l_flag;
 				node->r_flag = false;
@@ -235,14 +344,12 @@ namespace   ft
 			 * Insert a node at the right of its parent.
 			 *
 			 * @param node : the parent node.
-			 * @param val : the value inserted.
+			 * @param new_node : the new node.
 			 * @return : a pair, with its member pair::first set to an iterator pointing to either the
 			 * newly inserted element or to the element with an equivalent key in the map.
 			 */
-			ft::pair<iterator, bool>	insertRightNode (btree<const Key, T> *node, const value_type &val)
+			ft::pair<iterator, bool>	insertRightNode (btree<const Key, T> *node, btree<const Key, T> *new_node)
 			{
-				btree<const Key, T>   *new_node = this->_c_node_allocator.allocate(1);
-				this->_c_value_allocator.construct(&new_node->element, val);
 				new_node->right = node->right;
 				new_node->r_flag = node->r_flag;
 				new_node->l_flag = false;
@@ -260,14 +367,12 @@ namespace   ft
 			 * Insert a node at the left of its parent.
 			 *
 			 * @param node : the parent node.
-			 * @param val : the value inserted.
+			 * @param new_node : the new node.
 			 * @return : a pair, with its member pair::first set to an iterator pointing to either the
 			 * newly inserted element or to the element with an equivalent key in the map.
 			 */
-			ft::pair<iterator, bool>	insertLeftNode (btree<const Key, T> *node, const value_type &val)
+			ft::pair<iterator, bool>	insertLeftNode (btree<const Key, T> *node, btree<const Key, T> *new_node)
 			{
-				btree<const Key, T>   *new_node = this->_c_node_allocator.allocate(1);
-				this->_c_value_allocator.construct(&new_node->element, val);
 				new_node->left = node->left;
 				new_node->l_flag = node->l_flag;
 				new_node->r_flag = false;
@@ -281,6 +386,91 @@ namespace   ft
 				return (ft::pair<iterator, bool>(iterator(new_node), true));
 			}
 
+			/**
+			 * Searches the position of k and inserts a new element there if the key is missing.
+			 *
+			 * The node is only allocated once the descent has proven that k is not
+			 * in the tree, and the mapped value is built in place by build.
+			 *
+			 * @k : the key of the element.
+			 * @build : a builder constructing the mapped value at a given address.
+			 * @return : a pair, with its member pair::first set to an iterator pointing to either the
+			 * newly inserted element or to the element with an equivalent key in the map.
+			 */
+			template <class Builder>
+			ft::pair<iterator, bool>	emplaceKey (const key_type &k, const Builder &build)
+			{
+				btree<const Key, T>   *node;
+
+                //INSERT ROOT
+                if (this->_c_root->left == this->_c_root && this->_c_root->right == this->_c_root)
+                	return (insertRoot(createNode(k, build)));
+
+                node = this->_c_root->right;
+                while (true)
+                {
+                    if (keyLess(k, node->element.first))
+                    {
+                        if (node->r_flag == false)		//INSERT NODE AT THE RIGHT OF ITS PARENT
+                        {
+                            descentTo(node);
+                        	return (insertRightNode(node, createNode(k, build)));
+                        }
+                        node = node->right;
+                    }
+                    else if (keyLess(node->element.first, k))
+                    {
+                        if (node->l_flag == false)		//INSERT NODE AT THE LEFT OF ITS PARENT
+                        {
+                            descentTo(node);
+							return (insertLeftNode(node, createNode(k, build)));
+                        }
+                        node = node->left;
+                    }
+                    else
+                    {
+                        descentTo(node);
+                        return (ft::pair<iterator, bool>(iterator(node), false));
+                    }
+                }
+			}
+
+			/**
+			 * Inserts a new element using position as a hint.
+			 *
+			 * If k goes between the element before position and position itself, the new node
+			 * is linked right there, because one of these two nodes always has a free child on
+			 * the side of k. Otherwise the hint is ignored and the tree is searched from the root.
+			 *
+			 * @position : Hint for the position where the element can be inserted.
+			 * @k : the key of the element.
+			 * @build : a builder constructing the mapped value at a given address.
+			 * @return : an iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the map.
+			 */
+			template <class Builder>
+			iterator	emplaceHint (iterator position, const key_type &k, const Builder &build)
+			{
+				btree<const Key, T>	*next;
+				btree<const Key, T>	*prev;
+				iterator			before(position);
+
+				this->_cmp.hint_attempt();
+				if (this->_c_root->left == this->_c_root && this->_c_root->right == this->_c_root)
+					return (emplaceKey(k, build).first);
+				next = reinterpret_cast<btree<const Key, T> *>(&*position);
+				if (next != this->_c_root && !keyLess(k, next->element.first))
+					return (emplaceKey(k, build).first);
+				prev = reinterpret_cast<btree<const Key, T> *>(&*--before);
+				if (prev != this->_c_root && !keyLess(prev->element.first, k))
+					return (emplaceKey(k, build).first);
+
+				//prev < k < next, so k is linked under one of them.
+				this->_cmp.hint_hit();
+				if (next != this->_c_root && next->r_flag == false)
+					return (insertRightNode(next, createNode(k, build)).first);
+				return (insertLeftNode(prev, createNode(k, build)).first);
+			}
+
             btree<const Key, T>      *find_key (const key_type &k)
             {
                 btree<const Key, T>   *node = this->_c_root->right;
@@ -289,14 +479,14 @@ namespace   ft
                     return (NULL);
                 while (true)
                 {
-                    if (_cmp(k, node->element.first))
+                    if (keyLess(k, node->element.first))
                     {
                         if (node->r_flag == false)		//INSERT NODE AT THE RIGHT OF ITS PARENT
                         	return (node);
                         else
                             node = node->right;
                     }
-                    else if (_cmp(node->element.first, k))
+                    else if (keyLess(node->element.first, k))
                     {
                         if (node->l_flag == false)		//INSERT NODE AT THE LEFT OF ITS PARENT
 							return (node);
@@ -308,6 +498,202 @@ namespace   ft
                 }
             }
 
+			/**
+			 * Searches the tree from its root for the node of key k.
+			 *
+			 * @return : the node whose key is equivalent to k, or _c_root if there is none.
+			 */
+			btree<const Key, T>	*findNode (const key_type &k) const
+			{
+				btree<const Key, T>	*node = this->_c_root->right;
+
+				if (this->_c_size == 0)
+					return (this->_c_root);
+				while (true)
+				{
+					if (keyLess(k, node->element.first))
+					{
+						if (node->r_flag == false)
+							break ;
+						node = node->right;
+					}
+					else if (keyLess(node->element.first, k))
+					{
+						if (node->l_flag == false)
+							break ;
+						node = node->left;
+					}
+					else
+					{
+						descentTo(node);
+						return (node);
+					}
+				}
+				descentTo(node);
+				return (this->_c_root);
+			}
+
+			/**
+			 * Searches the tree from its root for the first node whose key does not go before k
+			 * (or, if strict, goes after k).
+			 *
+			 * Greater keys are on the left: every node that does not go before the bound is
+			 * a candidate, and the search goes on among its smaller keys, on its right.
+			 *
+			 * @return : the bound, or _c_root if every key goes before it.
+			 */
+			btree<const Key, T>	*boundNode (const key_type &k, bool strict) const
+			{
+				btree<const Key, T>	*node = this->_c_root->right;
+				btree<const Key, T>	*bound = this->_c_root;
+				bool				before;
+
+				if (this->_c_size == 0)
+					return (this->_c_root);
+				while (true)
+				{
+					before = strict ? !keyLess(k, node->element.first) : keyLess(node->element.first, k);
+					if (before)
+					{
+						if (node->l_flag == false)
+							break ;
+						node = node->left;
+					}
+					else
+					{
+						bound = node;
+						if (node->r_flag == false)
+							break ;
+						node = node->right;
+					}
+				}
+				descentTo(node);
+				return (bound);
+			}
+
+			/**
+			 * One pass of the Day-Stout-Warren algorithm.
+			 *
+			 * Performs count rotations along the vine hanging from the left of scanner,
+			 * which is made of nodes whose left child is the next greater node.
+			 *
+			 * @scanner : the node above the vine.
+			 * @count : the number of rotations to perform.
+			 */
+			void	compress (btree<const Key, T> *scanner, size_type count)
+			{
+				btree<const Key, T>	*child;
+
+				for (size_type i = 0; i < count; ++i)
+				{
+					child = scanner->left;
+					scanner->left = child->left;
+					scanner = scanner->left;
+					child->left = scanner->right;
+					scanner->right = child;
+				}
+				this->_cmp.rotation(count);
+			}
+
+			/**
+			 * Restores the flags, the threads and the parent links of a subtree whose missing children are NULL.
+			 *
+			 * @node : the root of the subtree.
+			 * @parent : the parent of node.
+			 * @pred / @succ : the nodes the threads of the subtree must point to on its smaller and greater sides.
+			 */
+			void	threadSubtree (btree<const Key, T> *node, btree<const Key, T> *parent, btree<const Key, T> *pred, btree<const Key, T> *succ)
+			{
+				node->previous = parent;
+				node->r_flag = (node->right != NULL);
+				if (node->r_flag == true)
+					threadSubtree(node->right, node, pred, node);
+				else
+					node->right = pred;
+				node->l_flag = (node->left != NULL);
+				if (node->l_flag == true)
+					threadSubtree(node->left, node, node, succ);
+				else
+					node->left = succ;
+			}
+
+			/**
+			 * Nodes built by build_sorted() before they are linked, as pointers to their elements.
+			 *
+			 * The destructor frees the nodes that are still in the batch, then the array, so that
+			 * nothing leaks if building a node or growing the array throws.
+			 */
+			struct	nodeBatch
+			{
+				typedef const ft::pair<const Key, T>	*item_type;
+
+				map							&owner;
+				item_type					*items;
+				size_type					size;
+				size_type					capacity;
+				std::allocator<item_type>	allocator;
+
+				nodeBatch (map &m): owner(m), items(NULL), size(0), capacity(0) {}
+
+				~nodeBatch (void)
+				{
+					for (size_type i = 0; i < this->size; ++i)
+						this->owner.destroyNode(node(i));
+					if (this->items != NULL)
+						this->allocator.deallocate(this->items, this->capacity);
+				}
+
+				//the element is the first member of its node
+				btree<const Key, T>	*node (size_type i) const
+				{
+					return (reinterpret_cast<btree<const Key, T> *>(const_cast<ft::pair<const Key, T> *>(this->items[i])));
+				}
+
+				/**
+				 * Makes room for one more node, doubling the array when it is full.
+				 */
+				void	reserveOne (void)
+				{
+					item_type	*larger;
+					size_type	n;
+
+					if (this->size < this->capacity)
+						return ;
+					n = this->capacity ? 2 * this->capacity : 64;
+					larger = this->allocator.allocate(n);
+					if (this->size > 0)
+						std::memcpy(larger, this->items, this->size * sizeof(item_type));
+					if (this->items != NULL)
+						this->allocator.deallocate(this->items, this->capacity);
+					this->items = larger;
+					this->capacity = n;
+				}
+			};
+
+			/**
+			 * Links a perfectly balanced tree from nodes sorted by key, with unique keys.
+			 *
+			 * Nothing is allocated, so this cannot throw. Missing children are left NULL,
+			 * threadSubtree() must be called on the result.
+			 *
+			 * @batch : the sorted nodes.
+			 * @begin / @end : the range of nodes to put in this subtree.
+			 * @return : the root of the subtree, or NULL if the range is empty.
+			 */
+			btree<const Key, T>	*buildBalanced (const nodeBatch &batch, size_type begin, size_type end)
+			{
+				btree<const Key, T>	*node;
+				size_type			mid;
+
+				if (begin >= end)
+					return (NULL);
+				mid = begin + (end - begin) / 2;
+				node = batch.node(mid);
+				node->right = buildBalanced(batch, begin, mid);
+				node->left = buildBalanced(batch, mid + 1, end);
+				return (node);
+			}
+
 	public:
         
             /**
@@ -321,7 +707,7 @@ namespace   ft
             explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
             {
                 this->_c_value_allocator = alloc;
-                this->_cmp = comp;
+                this->_cmp.comp = comp;
                 this->_c_root = this->_c_node_allocator.allocate(1);
                 this->_c_value_allocator.construct(&this->_c_root->element, value_type());
                 this->_c_root->r_flag = true;
@@ -344,7 +730,7 @@ namespace   ft
             map (InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
             {
                 this->_c_value_allocator = alloc;
-                this->_cmp = comp;
+                this->_cmp.comp = comp;
                 this->_c_root = this->_c_node_allocator.allocate(1);
                 this->_c_value_allocator.construct(&this->_c_root->element, value_type());
                 this->_c_root->r_flag = true;
@@ -362,7 +748,7 @@ namespace   ft
              * 
              * @x : Another map object of the same type (with the same class template arguments Key, T, Compare and Alloc), whose contents are either copied or acquired.
              */
-            map (const map& x): _c_value_allocator(x._c_value_allocator), _cmp(x._cmp)
+            map (const map& x): _c_value_allocator(x._c_value_allocator), _cmp(x._cmp.comp)
             {
 				this->_c_root = this->_c_node_allocator.allocate(1);
 				this->_c_value_allocator.construct(&this->_c_root->element, value_type());
@@ -379,6 +765,27 @@ namespace   ft
                     this->_c_root = NULL;
             }
 
+# if FT_CXX11
+            /**
+             * Move constructor.
+             * 
+             * Takes the nodes of x, which is left empty.
+             * 
+             * @x : Another map object of the same type.
+             */
+            map (map&& x): _c_value_allocator(x._c_value_allocator), _cmp(x._cmp.comp)
+            {
+				this->_c_root = this->_c_node_allocator.allocate(1);
+				this->_c_value_allocator.construct(&this->_c_root->element, value_type());
+				this->_c_root->r_flag = true;
+				this->_c_root->l_flag = false;
+				this->_c_root->right = this->_c_root;
+				this->_c_root->left = this->_c_root;
+				this->_c_size = 0;
+				swap(x);
+            }
+# endif
+
             /**
              * Destructor.
              */
@@ -389,13 +796,29 @@ namespace   ft
 		this->_c_node_allocator.deallocate(this->_c_root, 1);
             }
 
-            map &operator=(const map<Key, T> &x)
+            map &operator=(const map &x)
 	    {
 		    clear();
 		    insert(x.begin(), x.end());
 		    return (*this);
 	    }
 
+# if FT_CXX11
+            /**
+             * Move assignment: destroys the elements of the container, then takes the nodes of x.
+             */
+            map &operator=(map &&x)
+            {
+                if (this != &x)
+                {
+                    clear();
+                    swap(x);
+                    this->_cmp.comp = x._cmp.comp;
+                }
+                return (*this);
+            }
+# endif
+
         //ITERATORS
 
             /**
@@ -558,15 +981,7 @@ namespace   ft
              */
             mapped_type& operator[] (const key_type& k)
             {
-                iterator    it = find(k);
-                if (it == end())
-                {
-                    ft::pair<Key, T>    elem;
-                    elem.first = k;
-                    return (insert(elem).first->second);
-                }
-                else
-                    return (it->second);
+                return (try_emplace(k).first->second);
             }
 
         //MODIFIERS
@@ -582,38 +997,7 @@ namespace   ft
              */
             ft::pair<iterator,bool> insert (const value_type& val)
             {
-                btree<const Key, T>   *node = this->_c_node_allocator.allocate(1);
-                node->l_flag = false;
-                node->r_flag = false;
-                node->right = NULL;
-                node->left = NULL;
-                node->previous = NULL;
-
-                //INSERT ROOT
-                if (this->_c_root->left == this->_c_root && this->_c_root->right == this->_c_root)
-                	return (insertRoot(node, val));
-
-                node = this->_c_root->right;
-                while (true)
-                {
-                    if (_cmp(val.first, node->element.first))
-                    {
-                        if (node->r_flag == false)		//INSERT NODE AT THE RIGHT OF ITS PARENT
-                        	return (insertRightNode(node, val));
-                        else
-                            node = node->right;
-                    }
-                    else if (_cmp(node->element.first, val.first))
-                    {
-                        if (node->l_flag == false)		//INSERT NODE AT THE LEFT OF ITS PARENT
-							return (insertLeftNode(node, val));
-                        else
-                            node = node->left;
-                    }
-                    else
-                        return (ft::pair<iterator, bool>(iterator(node), false));
-                }
-                return (ft::pair<iterator, bool>(iterator(node), false));
+                return (emplaceKey(val.first, argBuilder<mapped_type>(val.second)));
             }
 
             /**
@@ -627,10 +1011,26 @@ namespace   ft
              */
             iterator insert (iterator position, const value_type& val)
             {
-                (void)position;
-                return (insert(val).first);
+                return (emplaceHint(position, val.first, argBuilder<mapped_type>(val.second)));
             }
 
+# if FT_CXX11
+            /**
+             * Insert elements. (single element, moved)
+             * 
+             * Same as above, but the mapped value of val is moved into the node.
+             */
+            ft::pair<iterator,bool> insert (value_type&& val)
+            {
+                return (emplaceKey(val.first, moveBuilder(val.second)));
+            }
+
+            iterator insert (iterator position, value_type&& val)
+            {
+                return (emplaceHint(position, val.first, moveBuilder(val.second)));
+            }
+# endif
+
             /**
              * Insert elements.
              * 
@@ -645,6 +1045,186 @@ namespace   ft
                     insert(*first++);
             }
 
+            /**
+             * Bulk construction.
+             * 
+             * Replaces the content of the container by the elements of [first,last), which do not need to be sorted.
+             * The range is read once, each element being copied into a new node, so it may be a single-pass range or
+             * the content of this map itself. The nodes are sorted by key with sorter, the duplicated keys are dropped
+             * and a balanced tree is linked in one pass. The content is the same as after inserting the range in an
+             * empty map. If an element cannot be copied, the map is left unchanged.
+             * 
+             * ft::build_parallel() of mapBuild.hpp calls it with a sorter running on several threads.
+             * 
+             * @first / @last : Iterators specifying a range of value_type.
+             * @sorter : an object whose member sort(items, n) stably sorts by key the n pointers to value_type of items.
+             * @last_wins : if true, the last element of a group of equivalent keys is kept (like a sequence of operator[]
+             * assignments), otherwise the first one is kept (like a sequence of insert()).
+             */
+            template <class InputIterator, class KeySorter>
+            void build_sorted (InputIterator first, InputIterator last, const KeySorter &sorter, bool last_wins = false)
+            {
+                nodeBatch           batch(*this);
+                btree<const Key, T> *root;
+                size_type           unique = 0;
+
+                for (; first != last; ++first)
+                {
+                    batch.reserveOne();
+                    batch.items[batch.size] = &createNode(first->first, argBuilder<mapped_type>(first->second))->element;
+                    ++batch.size;
+                }
+                sorter.sort(batch.items, batch.size);
+                for (size_type i = 0; i < batch.size; ++i)
+                {
+                    //the dropped nodes are swapped to the back, so that the batch still owns every node
+                    if (unique > 0 && !keyLess(batch.items[unique - 1]->first, batch.items[i]->first))
+                    {
+                        if (last_wins)
+                            std::swap(batch.items[unique - 1], batch.items[i]);
+                    }
+                    else
+                        std::swap(batch.items[unique++], batch.items[i]);
+                }
+                for (size_type i = unique; i < batch.size; ++i)
+                    destroyNode(batch.node(i));
+                batch.size = unique;
+                clear();
+                if (unique == 0)
+                    return ;
+                root = buildBalanced(batch, 0, unique);
+                batch.size = 0;
+                this->_c_root->right = root;
+                threadSubtree(root, this->_c_root, this->_c_root, this->_c_root);
+                this->_c_size = unique;
+            }
+
+            /**
+             * Insert element if the key does not exist.
+             * 
+             * If no element has a key equivalent to k, inserts a new element whose mapped value is
+             * default constructed directly inside the node. Otherwise nothing is allocated nor constructed.
+             * 
+             * @k : the key of the element to insert.
+             * @return : a pair, with its member pair::first set to an iterator pointing to either the newly inserted element or to the
+             * element with an equivalent key in the map. The pair::second element in the pair is set to true if a new element was inserted or false if an equivalent key already existed.
+             */
+            ft::pair<iterator,bool> try_emplace (const key_type& k)
+            {
+                return (emplaceKey(k, defaultBuilder()));
+            }
+
+# if FT_CXX11
+            /**
+             * Insert element if the key does not exist.
+             * 
+             * Same as above, but the mapped value is constructed in place as mapped_type(args...).
+             * The arguments are only used, and moved from, if the element is inserted.
+             * 
+             * @k : the key of the element to insert.
+             * @args : the arguments forwarded to the constructor of the mapped value.
+             * @return : see above.
+             */
+            template <class... Args>
+            ft::pair<iterator,bool> try_emplace (const key_type& k, Args&&... args)
+            {
+                return (emplaceKey(k, [&](T *where) { ::new (static_cast<void *>(where)) T(std::forward<Args>(args)...); }));
+            }
+
+            /**
+             * Construct and insert element.
+             * 
+             * Inserts a new element whose key is k and whose mapped value is constructed in place from args,
+             * if no element with an equivalent key is already in the map.
+             * 
+             * @k : the key of the element to insert.
+             * @args : the arguments forwarded to the constructor of the mapped value.
+             * @return : a pair, with its member pair::first set to an iterator pointing to either the newly inserted element or to the
+             * element with an equivalent key in the map. The pair::second element in the pair is set to true if a new element was inserted or false if an equivalent key already existed.
+             */
+            template <class... Args>
+            ft::pair<iterator,bool> emplace (const key_type& k, Args&&... args)
+            {
+                return (try_emplace(k, std::forward<Args>(args)...));
+            }
+
+            /**
+             * Construct and insert element with hint.
+             * 
+             * @position : Hint for the position where the element can be inserted.
+             * @k : the key of the element to insert.
+             * @args : the arguments forwarded to the constructor of the mapped value.
+             * @return : an iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the map.
+             */
+            template <class... Args>
+            iterator emplace_hint (iterator position, const key_type& k, Args&&... args)
+            {
+                return (emplaceHint(position, k, [&](T *where) { ::new (static_cast<void *>(where)) T(std::forward<Args>(args)...); }));
+            }
+# else
+            /**
+             * Insert element if the key does not exist.
+             * 
+             * Same as above, but the mapped value is constructed in place as mapped_type(a1).
+             * 
+             * @k : the key of the element to insert.
+             * @a1 : the argument forwarded to the constructor of the mapped value.
+             * @return : see above.
+             */
+            template <class A1>
+            ft::pair<iterator,bool> try_emplace (const key_type& k, const A1& a1)
+            {
+                return (emplaceKey(k, argBuilder<A1>(a1)));
+            }
+
+            /**
+             * Insert element if the key does not exist.
+             * 
+             * Same as above, but the mapped value is constructed in place as mapped_type(a1, a2).
+             * 
+             * @k : the key of the element to insert.
+             * @a1 / @a2 : the arguments forwarded to the constructor of the mapped value.
+             * @return : see above.
+             */
+            template <class A1, class A2>
+            ft::pair<iterator,bool> try_emplace (const key_type& k, const A1& a1, const A2& a2)
+            {
+                return (emplaceKey(k, argsBuilder<A1, A2>(a1, a2)));
+            }
+
+            /**
+             * Construct and insert element.
+             * 
+             * Inserts a new element whose key is k and whose mapped value is constructed in place from a1,
+             * if no element with an equivalent key is already in the map.
+             * 
+             * @k : the key of the element to insert.
+             * @a1 : the argument forwarded to the constructor of the mapped value.
+             * @return : a pair, with its member pair::first set to an iterator pointing to either the newly inserted element or to the
+             * element with an equivalent key in the map. The pair::second element in the pair is set to true if a new element was inserted or false if an equivalent key already existed.
+             */
+            template <class A1>
+            ft::pair<iterator,bool> emplace (const key_type& k, const A1& a1)
+            {
+                return (emplaceKey(k, argBuilder<A1>(a1)));
+            }
+
+            /**
+             * Construct and insert element with hint.
+             * 
+             * @position : Hint for the position where the element can be inserted.
+             * @k : the key of the element to insert.
+             * @a1 : the argument forwarded to the constructor of the mapped value.
+             * @return : an iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the map.
+             */
+            template <class A1>
+            iterator emplace_hint (iterator position, const key_type& k, const A1& a1)
+            {
+                return (emplaceHint(position, k, argBuilder<A1>(a1)));
+            }
+
+# endif
+
             /**
              * Removes elements.
              *
@@ -671,20 +1251,27 @@ namespace   ft
 
 				while (tmp)
 				{
-					if (_cmp(tmp->element.first, k))
+					if (keyLess(tmp->element.first, k))
 					{
 						if (tmp->l_flag == false)
+                        {
+                            descentTo(tmp);
                             return (0);
+                        }
                         tmp = tmp->left;
 					}
-					else if (_cmp(k, tmp->element.first))
+					else if (keyLess(k, tmp->element.first))
                     {
 						if (tmp->r_flag == false)
+                        {
+                            descentTo(tmp);
                             return (0);
+                        }
                         tmp = tmp->right;
 					}
                     else
                     {
+                        descentTo(tmp);
                         eraseElement(tmp);
                         return (1);
                     }
@@ -774,7 +1361,7 @@ namespace   ft
 			 */
 			key_compare     key_comp (void) const
 			{
-				return (_cmp);
+				return (this->_cmp.comp);
 			}
 
 			/**
@@ -801,17 +1388,7 @@ namespace   ft
              */
             iterator find (const key_type& k)
             {
-                iterator    it = begin();
-
-                if (this->_c_size == 0)
-                    return (end());
-                while (it != this->end())
-                {
-                    if (k == it->first)
-                        return (it);
-                    it++;
-                }
-                return (end());
+                return (iterator(findNode(k)));
             }
 
             /**
@@ -824,17 +1401,7 @@ namespace   ft
              */
             const_iterator find (const key_type& k) const
             {
-                iterator    it = begin();
-                
-                if (this->_c_size == 0)
-                    return (end());
-                while (it != this->end())
-                {
-                    if (k == it->first)
-                        return (it);
-                    it++;
-                }
-                return (end());
+                return (const_iterator(findNode(k)));
             }
 
             /**
@@ -848,12 +1415,7 @@ namespace   ft
              */
             size_type count (const key_type& k) const
             {
-                for (iterator it = begin(); it != end(); it++)
-                {
-                    if (it->first == k)
-                        return (1);
-                }
-                return (0);
+                return (findNode(k) != this->_c_root);
             }
 
             /**
@@ -868,12 +1430,7 @@ namespace   ft
              */
 			iterator lower_bound (const key_type& k)
 			{
-            	for (iterator it = begin(); it != end(); it++)
-				{
-            		if (!_cmp(it->first, k))
-            			return (it);
-				}
-            	return (end());
+				return (iterator(boundNode(k, false)));
 			}
 
 			/**
@@ -888,12 +1445,7 @@ namespace   ft
 			 */
 			const_iterator lower_bound (const key_type& k) const
 			{
-				for (const_iterator it = begin(); it != end(); it++)
-				{
-					if (!_cmp(it->first, k))
-						return (it);
-				}
-				return (end());
+				return (const_iterator(boundNode(k, false)));
 			}
 
 			/**
@@ -907,12 +1459,7 @@ namespace   ft
 			 */
 			iterator upper_bound (const key_type& k)
 			{
-				for (iterator it = begin(); it != end(); it++)
-				{
-					if (_cmp(k, it->first))
-						return (it);
-				}
-				return (end());
+				return (iterator(boundNode(k, true)));
 			}
 
 			/**
@@ -926,12 +1473,7 @@ namespace   ft
 			 */
 			const_iterator upper_bound (const key_type& k) const
 			{
-				for (const_iterator it = begin(); it != end(); it++)
-				{
-					if (_cmp(k, it->first))
-						return (it);
-				}
-				return (end());
+				return (const_iterator(boundNode(k, true)));
 			}
 
 			/**
@@ -962,41 +1504,206 @@ namespace   ft
 				return (ft::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));
 			}
 
+        //TREE SHAPE
+
+			/**
+			 * Return the height of the tree.
+			 *
+			 * @return : the number of nodes on the longest path from the root to a leaf, 0 if the map is empty.
+			 */
+			size_type	height (void) const
+			{
+				const btree<const Key, T>	*node = this->_c_root->right;
+				const btree<const Key, T>	*parent;
+				size_type					depth = 1;
+				size_type					max = 0;
+
+				if (node == this->_c_root)
+					return (0);
+				while (true)
+				{
+					if (depth > max)
+						max = depth;
+					if (node->r_flag == true || node->l_flag == true)
+					{
+						node = node->r_flag == true ? node->right : node->left;
+						++depth;
+						continue ;
+					}
+					//climb back to the first ancestor whose left subtree is still to visit
+					while (true)
+					{
+						parent = node->previous;
+						if (parent == this->_c_root)
+							return (max);
+						--depth;
+						if (parent->l_flag == true && parent->left != node)
+						{
+							node = parent->left;
+							++depth;
+							break ;
+						}
+						node = parent;
+					}
+				}
+			}
+
+			/**
+			 * Check the structure of the tree.
+			 *
+			 * Walks the whole tree and checks that the keys are strictly increasing, that every child
+			 * points back to its parent, that every thread points to the inorder neighbour of its node,
+			 * and that the number of nodes matches size().
+			 *
+			 * @return : true if the tree is consistent, false otherwise.
+			 */
+			bool	check_invariants (void) const
+			{
+				const btree<const Key, T>	*node = this->_c_root->right;
+				const btree<const Key, T>	*prev = this->_c_root;
+				size_type					count = 0;
+
+				if (this->_c_root->r_flag == false || this->_c_root->left != this->_c_root)
+					return (false);
+				if (node == this->_c_root)
+					return (this->_c_size == 0);
+				if (node->previous != this->_c_root)
+					return (false);
+				while (node->r_flag == true)
+					node = node->right;
+				while (node != this->_c_root)
+				{
+					if (++count > this->_c_size)
+						return (false);
+					if (prev != this->_c_root && !keyLess(prev->element.first, node->element.first))
+						return (false);
+					if (node->r_flag == true ? node->right->previous != node : node->right != prev)
+						return (false);
+					prev = node;
+					if (node->l_flag == false)
+						node = node->left;
+					else
+					{
+						if (node->left->previous != node)
+							return (false);
+						node = node->left;
+						while (node->r_flag == true)
+							node = node->right;
+					}
+				}
+				return (count == this->_c_size);
+			}
+
+			/**
+			 * Rebalance the tree.
+			 *
+			 * Rebuilds the tree into a perfectly balanced shape in O(n) time, relinking the existing
+			 * nodes (Day-Stout-Warren): no element is copied, allocated nor moved, so iterators stay valid.
+			 */
+			void	rebalance (void)
+			{
+				btree<const Key, T>	*node;
+				btree<const Key, T>	*next;
+				btree<const Key, T>	*tail = this->_c_root;
+				btree<const Key, T>	*root;
+				size_type			full = 1;
+				size_type			size;
+
+				if (this->_c_size < 2)
+					return ;
+
+				//turn the tree into a vine: every node has the next greater node as left child
+				node = rightNode(this->_c_root->right);
+				for (size_type i = 0; i < this->_c_size; ++i)
+				{
+					next = inorderSuccessor(node);
+					tail->left = node;
+					node->right = NULL;
+					tail = node;
+					node = next;
+				}
+				tail->left = NULL;
+
+				//fold the vine into a complete tree
+				while (full * 2 <= this->_c_size + 1)
+					full *= 2;
+				compress(this->_c_root, this->_c_size + 1 - full);
+				for (size = full - 1; size > 1; size /= 2)
+					compress(this->_c_root, size / 2);
+
+				root = this->_c_root->left;
+				this->_c_root->left = this->_c_root;
+				this->_c_root->right = root;
+				threadSubtree(root, this->_c_root, this->_c_root, this->_c_root);
+			}
+
+        //STATISTICS
+
+			/**
+			 * Return the statistics of the map.
+			 *
+			 * Only counts something when the Stats policy of the map is ft::map_stats.
+			 *
+			 * @return : the counters collected since the construction of the map or the last reset_stats().
+			 */
+			const Stats	&stats (void) const
+			{
+				return (this->_cmp);
+			}
+
+			/**
+			 * Reset every counter of the map to zero.
+			 */
+			void	reset_stats (void)
+			{
+				this->_cmp.reset();
+			}
+
+			/**
+			 * Print the statistics of the map.
+			 *
+			 * @os : the stream to write to.
+			 */
+			void	dump_stats (std::ostream &os = std::cerr) const
+			{
+				ft::dump_stats(os, this->_cmp);
+			}
+
     };
 
-	template <class Key, class T, class Compare, class Alloc>
-	void swap(ft::map<Key, T, Compare, Alloc> &x, ft::map<Key, T, Compare, Alloc> &y)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	void swap(ft::map<Key, T, Compare, Alloc, Stats> &x, ft::map<Key, T, Compare, Alloc, Stats> &y)
 	{
 		x.swap(y);
 	};
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator==(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	bool operator==(const map<Key, T, Compare, Alloc, Stats> &lhs, const map<Key, T, Compare, Alloc, Stats> &rhs)
 	{
 		if (lhs.size() != rhs.size())
 			return (false);
-		typename ft::map<Key, T, Compare, Alloc>::const_iterator it = lhs.begin();
-		typename ft::map<Key, T, Compare, Alloc>::const_iterator it2 = rhs.begin();
+		typename ft::map<Key, T, Compare, Alloc, Stats>::const_iterator it = lhs.begin();
+		typename ft::map<Key, T, Compare, Alloc, Stats>::const_iterator it2 = rhs.begin();
 		while (it != lhs.end() && it2 != rhs.end())
 		{
 			if (it->first != it2->first || it->second != it2->second)
 				return (false);
-			--it;
-			--it2;
+			++it;
+			++it2;
 		}
 		return (true);
 	};
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator!=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	bool operator!=(const map<Key, T, Compare, Alloc, Stats> &lhs, const map<Key, T, Compare, Alloc, Stats> &rhs)
 	{
 		return (!(lhs == rhs));
 	};
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	bool operator>(const map<Key, T, Compare, Alloc, Stats> &lhs, const map<Key, T, Compare, Alloc, Stats> &rhs)
 	{
 		if (lhs.size() > rhs.size())
 			return (true);
-		typename ft::map<Key, T, Compare, Alloc>::const_iterator it = lhs.begin();
-		typename ft::map<Key, T, Compare, Alloc>::const_iterator it2 = rhs.begin();
+		typename ft::map<Key, T, Compare, Alloc, Stats>::const_iterator it = lhs.begin();
+		typename ft::map<Key, T, Compare, Alloc, Stats>::const_iterator it2 = rhs.begin();
 		while (it != lhs.end() && it2 != rhs.end())
 		{
 			if (*it > *it2)
@@ -1006,18 +1713,18 @@ namespace   ft
 		}
 		return (false);
 	};
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	bool operator<(const map<Key, T, Compare, Alloc, Stats> &lhs, const map<Key, T, Compare, Alloc, Stats> &rhs)
 	{
 		return (!(lhs > rhs) && !(lhs == rhs));
 	};
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	bool operator>=(const map<Key, T, Compare, Alloc, Stats> &lhs, const map<Key, T, Compare, Alloc, Stats> &rhs)
 	{
 		return (!(lhs < rhs));
 	};
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Stats>
+	bool operator<=(const map<Key, T, Compare, Alloc, Stats> &lhs, const map<Key, T, Compare, Alloc, Stats> &rhs)
 	{
 		return (!(lhs > rhs));
 	};
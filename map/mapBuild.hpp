@@ -0,0 +1,84 @@
+#ifndef MAPBUILD_HPP
+# define MAPBUILD_HPP
+# include "map.hpp"
+# include "../vector/parallel.hpp"
+# include <cstddef>
+
+namespace   ft
+{
+    /**
+     * Sorts an array of pointers to pairs by key, with several threads.
+     *
+     * The array is sorted by ft::parallel::stable_sort on a pool of the requested number of
+     * threads. The sort is stable, so pairs with equivalent keys keep the order they had in the array.
+     *
+     * This header is not included by map.hpp: it brings in the thread pool of the vector, so a
+     * program using it must be linked with -pthread.
+     */
+    template <class Value, class Compare>
+    class   parallel_key_sorter
+    {
+        public:
+            typedef const Value     *item_type;
+
+        private:
+            /**
+             * Orders two items by the keys they point to.
+             */
+            struct  itemLess
+            {
+                Compare     cmp;
+
+                explicit itemLess (const Compare &c): cmp(c) {}
+
+                bool    operator() (item_type a, item_type b) const { return (cmp(a->first, b->first)); }
+            };
+
+            Compare                 _cmp;
+            size_t                  _nthreads;
+
+        public:
+            explicit parallel_key_sorter (const Compare &cmp = Compare(), size_t nthreads = 1): _cmp(cmp), _nthreads(nthreads) {}
+
+            /**
+             * Sort items[0, n) by key.
+             *
+             * @items : the array to sort.
+             * @n : the number of items.
+             */
+            void    sort (item_type *items, size_t n) const
+            {
+                if (n < 2)
+                    return ;
+                if (this->_nthreads < 2 || n < ft::parallel::PARALLEL_THRESHOLD)
+                {
+                    ft::stable_sort(items, items + n, itemLess(this->_cmp));
+                    return ;
+                }
+
+                ft::parallel::thread_pool   pool(this->_nthreads);
+
+                ft::parallel::stable_sort(pool, items, items + n, itemLess(this->_cmp));
+            }
+    };
+
+    /**
+     * Parallel bulk construction.
+     *
+     * Replaces the content of m by the elements of [first,last), which do not need to be sorted,
+     * sorting them by key with up to nthreads threads. See map::build_sorted().
+     *
+     * @m : the map to fill.
+     * @first / @last : Iterators specifying a range of value_type.
+     * @nthreads : the maximum number of threads used to sort the elements.
+     * @last_wins : if true, the last element of a group of equivalent keys is kept, otherwise the first one.
+     */
+    template <class Key, class T, class Compare, class Alloc, class Stats, class InputIterator>
+    void    build_parallel (ft::map<Key, T, Compare, Alloc, Stats> &m, InputIterator first, InputIterator last,
+                            size_t nthreads, bool last_wins = false)
+    {
+        m.build_sorted(first, last, parallel_key_sorter<ft::pair<const Key, T>, Compare>(m.key_comp(), nthreads), last_wins);
+    }
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef MAPITERATORS_HPP
 # define MAPITERATORS_HPP
 # include "btree.h"
+# include <iterator>
 
 namespace   ft
 {
@@ -17,6 +18,7 @@ namespace   ft
 			typedef	ft::pair<const Key, T>				*pointer;
 			typedef	ft::pair<const Key, const T>		*const_pointer;
 			typedef	std::ptrdiff_t						difference_type;
+			typedef	std::bidirectional_iterator_tag			iterator_category;
         
         private:
             btree<Key, T>               *_i_root;
@@ -228,6 +230,7 @@ namespace   ft
 			typedef	ft::pair<const Key, T>					*pointer;
 			typedef	ft::pair<const Key, T>	const		*const_pointer;
 			typedef	std::ptrdiff_t						difference_type;
+			typedef	std::bidirectional_iterator_tag			iterator_category;
         
         private:
             btree<Key, T>               *_i_root;
@@ -353,13 +356,13 @@ namespace   ft
 			 */
 			mapConstIterator<Key, T> &operator++ (void)
 			{
-				if (this->_i_root->r_flag == false)
-					this->_i_root = this->_i_root->right;
+				if (this->_i_root->l_flag == false)
+					this->_i_root = this->_i_root->left;
 				else
 				{
-					this->_i_root = this->_i_root->right;
-					while (this->_i_root->l_flag == true)
-						this->_i_root = this->_i_root->left;
+					this->_i_root = this->_i_root->left;
+					while (this->_i_root->r_flag == true)
+						this->_i_root = this->_i_root->right;
 				}
 				return (*this);
 			}
@@ -371,13 +374,13 @@ namespace   ft
 			 */
 			mapConstIterator<Key, T> &operator-- (void)
 			{
-				if (this->_i_root->l_flag == false)
-					this->_i_root = this->_i_root->left;
+				if (this->_i_root->r_flag == false)
+					this->_i_root = this->_i_root->right;
 				else
 				{
-					this->_i_root = this->_i_root->left;
-					while (this->_i_root->r_flag == true)
-						this->_i_root = this->_i_root->right;
+					this->_i_root = this->_i_root->right;
+					while (this->_i_root->l_flag == true)
+						this->_i_root = this->_i_root->left;
 				}
 				return (*this);
 			}
@@ -0,0 +1,223 @@
+#ifndef MAPSNAPSHOT_HPP
+# define MAPSNAPSHOT_HPP
+# include "map.hpp"
+# include <cstdio>
+# include <cstring>
+# include <stdexcept>
+# include <string>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+
+namespace   ft
+{
+    /**
+     * Header of a map snapshot file.
+     *
+     * A snapshot is this header followed by size() entries of type ft::pair<Key, T>,
+     * sorted by key. It holds no pointer, only offsets from the beginning of the file,
+     * so it can be mapped anywhere in memory and queried in place.
+     *
+     * Only maps whose key and mapped types are trivially copyable can be written this way.
+     */
+    struct  snapshot_header
+    {
+        char                magic[8];
+        unsigned long long  version;
+        unsigned long long  count;
+        unsigned long long  entry_size;
+        unsigned long long  entries_offset;
+        unsigned long long  reserved[3];
+    };
+
+    static const char                   SNAPSHOT_MAGIC[8] = {'F', 'T', 'M', 'A', 'P', 'S', 'N', 'P'};
+    static const unsigned long long     SNAPSHOT_VERSION = 1;
+
+    /**
+     * Write a map snapshot.
+     *
+     * Writes every element of m, in the map order, to the file at path.
+     *
+     * @m : the map to write.
+     * @path : the path of the file to create (or truncate).
+     */
+    template <class Key, class T, class Compare, class Alloc, class Stats>
+    void    write_snapshot (const ft::map<Key, T, Compare, Alloc, Stats> &m, const char *path)
+    {
+        typedef ft::pair<Key, T>    entry_type;
+
+        enum { checks = sizeof(ft::static_check<ft::is_trivially_copyable<Key>::value && ft::is_trivially_copyable<T>::value>) };
+
+        std::FILE                   *file = std::fopen(path, "wb");
+        snapshot_header             header;
+        unsigned char               buf[sizeof(entry_type)];
+        bool                        good;
+
+        if (file == NULL)
+            throw std::runtime_error(std::string("map::write_snapshot: cannot open ") + path);
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = SNAPSHOT_VERSION;
+        header.count = m.size();
+        header.entry_size = sizeof(entry_type);
+        header.entries_offset = sizeof(header);
+        good = std::fwrite(&header, sizeof(header), 1, file) == 1;
+        for (typename ft::map<Key, T, Compare, Alloc, Stats>::const_iterator it = m.begin(); good && it != m.end(); ++it)
+        {
+            //zeroed buffer, so that the padding bytes of the file are deterministic
+            std::memset(buf, 0, sizeof(buf));
+            ::new (static_cast<void *>(buf)) entry_type(it->first, it->second);
+            good = std::fwrite(buf, sizeof(buf), 1, file) == 1;
+        }
+        if (std::fclose(file) != 0 || !good)
+            throw std::runtime_error(std::string("map::write_snapshot: cannot write ") + path);
+    }
+
+    /**
+     * Read-only view on a map snapshot.
+     *
+     * The file is mapped read-only and the sorted entries are searched in place,
+     * so opening a snapshot costs neither a copy nor an insertion per element.
+     */
+    template < class Key, class T, class Compare = std::less<Key> >
+    class map_view
+    {
+        public:
+            typedef Key                                 key_type;
+            typedef T                                   mapped_type;
+            typedef ft::pair<Key, T>                    value_type;
+            typedef Compare                             key_compare;
+            typedef const value_type                    &const_reference;
+            typedef const value_type                    *const_pointer;
+            typedef const value_type                    *const_iterator;
+            typedef std::ptrdiff_t                      difference_type;
+            typedef size_t                              size_type;
+
+        private:
+            void                *_v_addr;
+            size_t              _v_length;
+            const value_type    *_v_entries;
+            size_type           _v_size;
+            key_compare         _cmp;
+
+            //the entries are read in place, not built: Key and T must be trivially copyable
+            enum { checks = sizeof(ft::static_check<ft::is_trivially_copyable<Key>::value && ft::is_trivially_copyable<T>::value>) };
+
+            map_view (const map_view &x);
+            map_view &operator= (const map_view &x);
+
+            void    fail (int fd, const char *what, const char *path)
+            {
+                if (fd >= 0)
+                    ::close(fd);
+                throw std::runtime_error(std::string("map_view: ") + what + " " + path);
+            }
+
+        public:
+
+            /**
+             * Constructor.
+             *
+             * Maps the snapshot at path and checks its header.
+             *
+             * @path : the path of a file written by ft::write_snapshot with the same Key and T.
+             * @comp : the comparison object the snapshot was sorted with.
+             */
+            explicit map_view (const char *path, const key_compare &comp = key_compare()): _cmp(comp)
+            {
+                int             fd = ::open(path, O_RDONLY);
+                struct stat     st;
+                snapshot_header header;
+
+                if (fd < 0)
+                    fail(fd, "cannot open", path);
+                if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(header))
+                    fail(fd, "truncated snapshot", path);
+                this->_v_length = st.st_size;
+                this->_v_addr = ::mmap(NULL, this->_v_length, PROT_READ, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (this->_v_addr == MAP_FAILED)
+                    fail(-1, "cannot map", path);
+                std::memcpy(&header, this->_v_addr, sizeof(header));
+                if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0
+                    || header.version != SNAPSHOT_VERSION || header.entry_size != sizeof(value_type)
+                    || header.entries_offset > this->_v_length
+                    || header.entries_offset % ft::alignment_of<value_type>::value != 0
+                    || header.count > (this->_v_length - header.entries_offset) / header.entry_size)
+                {
+                    ::munmap(this->_v_addr, this->_v_length);
+                    fail(-1, "invalid snapshot", path);
+                }
+                this->_v_entries = reinterpret_cast<const value_type *>(static_cast<const char *>(this->_v_addr) + header.entries_offset);
+                this->_v_size = header.count;
+            }
+
+            /**
+             * Destructor.
+             */
+            ~map_view (void)
+            {
+                ::munmap(this->_v_addr, this->_v_length);
+            }
+
+            const_iterator  begin (void) const { return (this->_v_entries); }
+            const_iterator  end (void) const { return (this->_v_entries + this->_v_size); }
+            size_type       size (void) const { return (this->_v_size); }
+            bool            empty (void) const { return (this->_v_size == 0); }
+
+            /**
+             * Return iterator to lower bound.
+             *
+             * @k : Key to search for.
+             * @return : the first entry whose key is not considered to go before k, or end().
+             */
+            const_iterator  lower_bound (const key_type &k) const
+            {
+                const_iterator  first = begin();
+                size_type       count = this->_v_size;
+                size_type       half;
+
+                while (count > 0)
+                {
+                    half = count / 2;
+                    if (_cmp(first[half].first, k))
+                    {
+                        first += half + 1;
+                        count -= half + 1;
+                    }
+                    else
+                        count = half;
+                }
+                return (first);
+            }
+
+            /**
+             * Get iterator to element.
+             *
+             * @k : Key to be searched for.
+             * @return : the entry with a key equivalent to k, or end().
+             */
+            const_iterator  find (const key_type &k) const
+            {
+                const_iterator  it = lower_bound(k);
+
+                if (it == end() || _cmp(k, it->first))
+                    return (end());
+                return (it);
+            }
+
+            /**
+             * Count elements with specific keys.
+             *
+             * @k : key to search.
+             * @return : 1 if the snapshot contains k, or zero otherwise.
+             */
+            size_type       count (const key_type &k) const
+            {
+                return (find(k) != end());
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef MAPSTATS_HPP
+# define MAPSTATS_HPP
+# include <iostream>
+# include <cstddef>
+
+namespace   ft
+{
+    /**
+     * Statistics policies of ft::map.
+     *
+     * The last template parameter of a map is a policy whose member functions are called on every
+     * key comparison, node allocation and deallocation, descent from the root, hinted insertion and
+     * rotation. The default, map_no_stats, does nothing: its calls are inlined away and, being
+     * empty, it adds nothing to the size of a map. Use ft::map<Key, T, Compare, Alloc, ft::map_stats>
+     * to count them.
+     *
+     * enabled tells the map whether the depth of a descent is worth computing.
+     */
+    struct  map_no_stats
+    {
+        static const bool   enabled = false;
+
+        void    reset (void) {}
+        void    comparison (void) {}
+        void    node_allocation (void) {}
+        void    node_free (void) {}
+        void    descent (size_t) {}
+        void    hint_attempt (void) {}
+        void    hint_hit (void) {}
+        void    rotation (size_t) {}
+    };
+
+    /**
+     * Statistics policy counting what a map does.
+     */
+    struct  map_stats
+    {
+        static const bool   enabled = true;
+
+        size_t  comparisons;        //calls to the key comparison object
+        size_t  node_allocations;   //element nodes allocated
+        size_t  node_frees;         //element nodes deallocated
+        size_t  descents;           //searches from the root of the tree
+        size_t  total_depth;        //sum of the depths reached by the descents
+        size_t  max_depth;          //deepest node reached by a descent
+        size_t  hint_attempts;      //insertions with a hint
+        size_t  hint_hits;          //hints that were used as is
+        size_t  rotations;          //rotations performed to rebalance the tree
+
+        map_stats (void) { reset(); }
+
+        void    reset (void)
+        {
+            comparisons = 0;
+            node_allocations = 0;
+            node_frees = 0;
+            descents = 0;
+            total_depth = 0;
+            max_depth = 0;
+            hint_attempts = 0;
+            hint_hits = 0;
+            rotations = 0;
+        }
+
+        void    comparison (void) { ++comparisons; }
+        void    node_allocation (void) { ++node_allocations; }
+        void    node_free (void) { ++node_frees; }
+        void    hint_attempt (void) { ++hint_attempts; }
+        void    hint_hit (void) { ++hint_hits; }
+        void    rotation (size_t count) { rotations += count; }
+
+        void    descent (size_t depth)
+        {
+            ++descents;
+            total_depth += depth;
+            if (depth > max_depth)
+                max_depth = depth;
+        }
+
+        double  average_depth (void) const
+        {
+            return (descents ? static_cast<double>(total_depth) / descents : 0.0);
+        }
+
+        double  hint_hit_rate (void) const
+        {
+            return (hint_attempts ? static_cast<double>(hint_hits) / hint_attempts : 0.0);
+        }
+    };
+
+    /**
+     * The comparison object of a map, deriving from its statistics policy,
+     * so that an empty policy takes no room in the map.
+     */
+    template <class Compare, class Stats>
+    struct  mapCompare: public Stats
+    {
+        Compare comp;
+
+        mapCompare (const Compare &c = Compare()): Stats(), comp(c) {}
+    };
+
+    /**
+     * Prints that a map without statistics counted nothing.
+     *
+     * @os : the stream to write to.
+     */
+    inline void dump_stats (std::ostream &os, const map_no_stats &)
+    {
+        os << "statistics disabled" << std::endl;
+    }
+
+    /**
+     * Prints every counter of s, one per line.
+     *
+     * @os : the stream to write to.
+     * @s : the counters to print.
+     */
+    inline void dump_stats (std::ostream &os, const map_stats &s)
+    {
+        os << "comparisons:      " << s.comparisons << std::endl;
+        os << "node allocations: " << s.node_allocations << std::endl;
+        os << "node frees:       " << s.node_frees << std::endl;
+        os << "descents:         " << s.descents << std::endl;
+        os << "average depth:    " << s.average_depth() << std::endl;
+        os << "max depth:        " << s.max_depth << std::endl;
+        os << "hint hit rate:    " << s.hint_hit_rate() << " (" << s.hint_hits << "/" << s.hint_attempts << ")" << std::endl;
+        os << "rotations:        " << s.rotations << std::endl;
+    }
+}
+
+#endif
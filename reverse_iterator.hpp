@@ -2,6 +2,7 @@
 # define REVERSE_ITERATOR_HPP
 # include <cstddef>
 # include "map/pair.hpp"
+# include "utils.hpp"
 
 namespace   ft
 {
@@ -28,6 +29,7 @@ namespace   ft
 			typedef	typename Iterator::reference				reference;
 			typedef	typename Iterator::value_type				value_type;
 			typedef ptrdiff_t   								difference_type;
+			typedef typename ft::iterator_category<Iterator>::type		iterator_category;
 
 		private:
 			iterator_type it;
@@ -132,6 +134,7 @@ namespace   ft
 		typedef	typename ConstIterator::const_reference			const_reference;
 		typedef	typename ConstIterator::value_type				value_type;
 		typedef ptrdiff_t   								difference_type;
+		typedef typename ft::iterator_category<ConstIterator>::type		iterator_category;
 
 	private:
 		iterator_type it;
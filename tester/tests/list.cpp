@@ -326,6 +326,36 @@ static void operators(void)
 	check("l1 <= l2", (l1 <= l3), (l2 <= l4));
 }
 
+#if FT_CXX11
+static void move_semantics(void)
+{
+	print_header("Move semantics");
+	ft::list<copy_counter> l1;
+	copy_counter c(7);
+
+	copy_counter::copies = 0;
+	for (int i = 0; i < 10; i++)
+		l1.push_back(copy_counter(i));
+	l1.push_front(copy_counter(-1));
+	l1.emplace_back(10);
+	l1.emplace_front(-2);
+	ft::list<copy_counter>::iterator it = l1.emplace(++l1.begin(), -3);
+	l1.insert(l1.end(), FT_MOVE(c));
+	check("(push/emplace/insert) copies", copy_counter::copies, 0);
+	check("(emplace) returned iterator", (*it).value, -3);
+	check("l1.front() / l1.back()", l1.front().value == -2 && l1.back().value == 7);
+	check("l1.size()", l1.size(), (size_t)15);
+
+	ft::list<copy_counter> l2(FT_MOVE(l1));
+	check("(move ctor) l2.size() / l1.empty()", l2.size() == 15 && l1.empty());
+	l1 = FT_MOVE(l2);
+	check("(move assign) l1.size() / l2.empty()", l1.size() == 15 && l2.empty());
+	l2.splice(l2.begin(), ft::list<copy_counter>(3, copy_counter(5)));
+	check("(splice list&&) l2.size()", l2.size(), (size_t)3);
+	check("(all) copies", copy_counter::copies, 3);
+}
+#endif
+
 void test_list(void)
 {
 	std::srand(time(0));
@@ -345,4 +375,7 @@ void test_list(void)
 	merge();
 	reverse();
 	operators();
+#if FT_CXX11
+	move_semantics();
+#endif
 }
@@ -1,6 +1,11 @@
 #include "tests.hpp"
+#include "../../map/mapSnapshot.hpp"
+#include "../../map/mapBuild.hpp"
 #include <map>
 #include <utility>
+#include <cstdlib>
+#include <stdexcept>
+#include <unistd.h>
 
 template <class T>
 static void print_map(T &map)
@@ -101,6 +106,15 @@ static void insert(void)
 	m1.insert(++m1.begin(), ft::pair<int, int>(5, 5));
 	m2.insert(++m2.begin(), std::make_pair(5, 5));
 	check("m1 == m2", m1 == m2);
+	m1.insert(m1.end(), ft::pair<int, int>(7, 7));
+	m2.insert(m2.end(), std::make_pair(7, 7));
+	m1.insert(m1.begin(), ft::pair<int, int>(-3, 3));
+	m2.insert(m2.begin(), std::make_pair(-3, 3));
+	m1.insert(m1.find(5), ft::pair<int, int>(4, 4));
+	m2.insert(m2.find(5), std::make_pair(4, 4));
+	m1.insert(m1.begin(), ft::pair<int, int>(6, 6));
+	m2.insert(m2.begin(), std::make_pair(6, 6));
+	check("(hint) m1 == m2", m1 == m2);
 	m1.insert(ft::pair<int, int>(5, 0));
 	m2.insert(std::make_pair(5, 0));
 	m1.insert(ft::pair<int, int>(10, 54));
@@ -108,6 +122,26 @@ static void insert(void)
 	check("m1 == m2", m1 == m2);
 }
 
+static void emplace(void)
+{
+	print_header("Emplace / Try_emplace");
+	ft::map<std::string, std::string> m1;
+	std::map<std::string, std::string> m2;
+	check("try_emplace() inserted", m1.try_emplace("a").second);
+	check("try_emplace(a1, a2) inserted", m1.try_emplace("b", (size_t)3, 'x').second);
+	check("emplace() inserted", m1.emplace("c", "42").second);
+	check("emplace() existing key", !m1.emplace("c", "21").second);
+	check("try_emplace() existing key", !m1.try_emplace("b", "yyy").second);
+	m1.emplace_hint(m1.begin(), "d", "hint");
+	m2.insert(std::make_pair("a", ""));
+	m2.insert(std::make_pair("b", "xxx"));
+	m2.insert(std::make_pair("c", "42"));
+	m2.insert(std::make_pair("d", "hint"));
+	check("m1 == m2", m1 == m2);
+	check("m1['c'] == m2['c']", m1["c"], m2["c"]);
+	check("m1.size() == m2.size()", m1.size(), m2.size());
+}
+
 static void erase(void)
 {
 	print_header("Erase");
@@ -284,6 +318,188 @@ static void operators_comp(void)
 	check("m1 <= m2", (m1 <= m3), (m2 <= m4));
 }
 
+static void shape(void)
+{
+	print_header("Height / Invariants / Rebalance");
+	ft::map<int, int> m1;
+	std::map<int, int> m2;
+	for (int i = 0; i < 1023; i++)
+	{
+		m1[i] = i;
+		m2[i] = i;
+	}
+	check("(sorted feed) m1.height()", m1.height(), (size_t)1023);
+	check("m1.check_invariants()", m1.check_invariants());
+	ft::map<int, int>::iterator it = m1.find(512);
+	m1.rebalance();
+	check("(rebalanced) m1.height()", m1.height(), (size_t)10);
+	check("m1.check_invariants()", m1.check_invariants());
+	check("iterators stay valid", it->first, 512);
+	check("m1 == m2", m1 == m2);
+	for (int i = 0; i < 1023; i += 3)
+	{
+		m1.erase(i);
+		m2.erase(i);
+	}
+	m1.erase(++m1.begin(), m1.find(600));
+	m2.erase(++m2.begin(), m2.find(600));
+	check("(erase) m1.check_invariants()", m1.check_invariants());
+	check("(erase) m1 == m2", m1 == m2);
+	bool same = true;
+	for (int k = -1; k <= 1023; k++)
+	{
+		same = same && (m1.find(k) == m1.end()) == (m2.find(k) == m2.end()) && m1.count(k) == m2.count(k);
+		same = same && (m1.lower_bound(k) == m1.end() ? m2.lower_bound(k) == m2.end() : m1.lower_bound(k)->first == m2.lower_bound(k)->first);
+		same = same && (m1.upper_bound(k) == m1.end() ? m2.upper_bound(k) == m2.end() : m1.upper_bound(k)->first == m2.upper_bound(k)->first);
+	}
+	check("(erase) find/count/bounds", same);
+
+	typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::map_stats> counted_map;
+	counted_map m3;
+	for (int i = 0; i < 1023; i++)
+		m3[i] = i;
+	m3.rebalance();
+	m3.reset_stats();
+	same = m3.find(700)->second == 700 && m3.count(1) == 1 && m3.lower_bound(1023) == m3.end() && m3.upper_bound(-1) == m3.begin();
+	check("(rebalanced) lookups", same);
+	//four lookups, at most two comparisons per level each
+	check("(rebalanced) O(height) comparisons", m3.stats().comparisons <= 4 * 2 * m3.height());
+	check("(rebalanced) lookup depth", m3.stats().max_depth, m3.height());
+}
+
+/**
+ * A value whose copy throws once copies_left reaches zero.
+ */
+struct throwing_value
+{
+	static int copies_left;
+	int v;
+
+	throwing_value(int x = 0): v(x) {}
+	throwing_value(const throwing_value &o): v(o.v)
+	{
+		if (copies_left-- == 0)
+			throw std::runtime_error("throwing_value");
+	}
+	throwing_value &operator=(const throwing_value &o)
+	{
+		v = o.v;
+		return (*this);
+	}
+};
+
+int throwing_value::copies_left = -1;
+
+static void build_parallel(void)
+{
+	print_header("Build parallel");
+	ft::vector<ft::pair<int, int> > v;
+	ft::map<int, int> m1;
+	ft::map<int, int> m3;
+	ft::map<int, int> m5;
+	std::map<int, int> m2;
+	std::map<int, int> m4;
+	for (int i = 0; i < 40000; i++)
+		v.push_back(ft::pair<int, int>((i * 7919) % 5000, i));
+	for (size_t i = 0; i < v.size(); i++)
+	{
+		m2.insert(std::make_pair(v[i].first, v[i].second));
+		m4[v[i].first] = v[i].second;
+	}
+	m1[-1] = -1;
+	ft::build_parallel(m1, v.begin(), v.end(), 4);
+	ft::build_parallel(m3, v.begin(), v.end(), 3, true);
+	ft::build_parallel(m5, v.begin(), v.begin(), 4);
+	check("(first wins) m1 == m2", m1 == m2);
+	check("(last wins) m3 == m4", m3 == m4);
+	check("m1.check_invariants()", m1.check_invariants());
+	check("m1.height()", m1.height(), (size_t)13);
+	check("(empty range) m5.empty()", m5.empty());
+	ft::build_parallel(m1, m1.begin(), m1.end(), 2);
+	check("(own range) m1 == m2", m1 == m2);
+
+	typedef ft::map<int, throwing_value, std::less<int>, std::allocator<ft::pair<const int, throwing_value> >, ft::map_stats> throwing_map;
+	std::vector<ft::pair<int, throwing_value> > w;
+	throwing_map m6;
+	for (int i = 0; i < 100; i++)
+		w.push_back(ft::pair<int, throwing_value>(i, throwing_value(i)));
+	m6[1] = throwing_value(7);
+	m6.reset_stats();
+	throwing_value::copies_left = 50;
+	try { ft::build_parallel(m6, w.begin(), w.end(), 2); } catch (std::runtime_error &) {}
+	throwing_value::copies_left = -1;
+	check("(throw) map unchanged", m6.size() == 1 && m6[1].v == 7);
+	check("(throw) every node freed", m6.stats().node_frees, m6.stats().node_allocations);
+}
+
+static void snapshot(void)
+{
+	print_header("Snapshot");
+	char path[] = "/tmp/ft_map_snapshotXXXXXX";
+	int fd = mkstemp(path);
+	ft::map<int, double> m1;
+	std::map<int, double> m2;
+	for (int i = 0; i < 1000; i++)
+	{
+		m1[(i * 7919) % 1000] = i * 0.5;
+		m2[(i * 7919) % 1000] = i * 0.5;
+	}
+	check("mkstemp()", fd >= 0);
+	close(fd);
+	ft::write_snapshot(m1, path);
+	{
+		ft::map_view<int, double> view(path);
+		ft::map<int, double> m3(view.begin(), view.end());
+		check("view.size() == m2.size()", view.size(), m2.size());
+		check("(round-trip) m3 == m2", m3 == m2);
+		check("view.find(42) == m2.find(42)", view.find(42)->second, m2.find(42)->second);
+		check("view.find(1000) == view.end()", view.find(1000) == view.end());
+		check("view.lower_bound(-1) == begin()", view.lower_bound(-1) == view.begin());
+		check("view.count(999) == m2.count(999)", view.count(999), m2.count(999));
+	}
+	ft::snapshot_header header;
+	bool rejected;
+	fd = open(path, O_RDWR);
+	check("(corrupt) read header", pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header));
+	//count * entry_size wraps around to a small offset
+	header.count = ~0ULL / header.entry_size + 2;
+	rejected = pwrite(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header);
+	try { ft::map_view<int, double> view(path); rejected = false; } catch (std::runtime_error &) {}
+	header.count = 1;
+	header.entries_offset = sizeof(header) + 1;
+	rejected = rejected && pwrite(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header);
+	try { ft::map_view<int, double> view(path); rejected = false; } catch (std::runtime_error &) {}
+	close(fd);
+	check("(corrupt) count/offset rejected", rejected);
+	unlink(path);
+}
+
+#if FT_CXX11
+static void move_semantics(void)
+{
+	print_header("Move semantics");
+	ft::map<int, std::string> m1;
+	std::string s(100, 'x');
+
+	m1.insert(ft::pair<const int, std::string>(1, std::string(50, 'a')));
+	m1.emplace(2, 3, 'b');
+	m1.try_emplace(3, FT_MOVE(s));
+	m1.emplace_hint(m1.end(), 4, "dddd");
+	check("m1.size()", m1.size(), (size_t)4);
+	check("(try_emplace) moved from s", s.empty());
+	check("m1[2] / m1[4]", m1[2] == "bbb" && m1[4] == "dddd");
+	check("m1[3].size()", m1[3].size(), (size_t)100);
+	std::string t(10, 't');
+	check("(existing key) try_emplace", !m1.try_emplace(3, FT_MOVE(t)).second && t.size() == 10);
+
+	ft::map<int, std::string> m2(FT_MOVE(m1));
+	check("(move ctor) m2.size() / m1.empty()", m2.size() == 4 && m1.empty());
+	m1 = FT_MOVE(m2);
+	check("(move assign) m1.size() / m2.empty()", m1.size() == 4 && m2.empty());
+	check("(move assign) m1[1].size()", m1[1].size(), (size_t)50);
+}
+#endif
+
 void test_map(void)
 {
 	print_header("Map");
@@ -291,6 +507,7 @@ void test_map(void)
 	max_size();
 	access_operator();
 	insert();
+	emplace();
 	erase();
 	swap();
 	clear();
@@ -299,4 +516,11 @@ void test_map(void)
 	bounds();
 	range();
 	operators_comp();
+	shape();
+	build_parallel();
+	snapshot();
+	test_map_stats();
+#if FT_CXX11
+	move_semantics();
+#endif
 }
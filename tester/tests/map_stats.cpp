@@ -0,0 +1,47 @@
+#include "tests.hpp"
+#include <sstream>
+
+void test_map_stats(void)
+{
+	print_header("Map statistics");
+	typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::map_stats> counted_map;
+	counted_map m1;
+	std::map<int, int> m2;
+	for (int i = 0; i < 100; i++)
+	{
+		m1[i] = i;
+		m2[i] = i;
+	}
+	check("m1 == m2", m1 == m2);
+	check("node allocations", m1.stats().node_allocations, (size_t)100);
+	check("sorted feed max depth", m1.stats().max_depth, (size_t)99);
+	check("comparisons counted", m1.stats().comparisons > 0);
+	m1.reset_stats();
+	m1.insert(m1.end(), ft::pair<int, int>(100, 100));
+	m1.insert(m1.begin(), ft::pair<int, int>(-1, -1));
+	m1.insert(m1.begin(), ft::pair<int, int>(50, 50));
+	m2.insert(std::make_pair(100, 100));
+	m2.insert(std::make_pair(-1, -1));
+	check("m1 == m2", m1 == m2);
+	check("hint attempts", m1.stats().hint_attempts, (size_t)3);
+	check("hint hits", m1.stats().hint_hits, (size_t)2);
+	check("node allocations", m1.stats().node_allocations, (size_t)2);
+	counted_map m3;
+	m3[2] = 2;
+	m3[1] = 1;
+	m3[3] = 3;
+	m3.erase(1);
+	check("node frees", m3.stats().node_frees, (size_t)1);
+	check("balanced max depth", m3.stats().max_depth, (size_t)2);
+	check("(no stats) empty policy", sizeof(ft::map<int, int>) < sizeof(counted_map));
+	counted_map m4;
+	m4 = m3;
+	m3[4] = 4;
+	check("(assign) deep copy", m4.size(), (size_t)2);
+	check("(assign) nodes not shared", m4.count(4), (size_t)0);
+	m3.clear();
+	check("(assign) survives the source", m4[2] + m4[3], 5);
+	std::ostringstream	out;
+	ft::map<int, int>().dump_stats(out);
+	check("(no stats) dump_stats", out.str(), std::string("statistics disabled\n"));
+}
@@ -8,6 +8,8 @@
 # include <queue>
 # include <iostream>
 # include "../../vector/vector.hpp"
+# include "../../vector/smallVector.hpp"
+# include "../../vector/staticVector.hpp"
 # include "../../list/list.hpp"
 # include "../../map/map.hpp"
 # include "../../queue/queue.hpp"
@@ -33,6 +35,7 @@
 void	test_vector(void);
 void	test_list(void);
 void	test_map(void);
+void	test_map_stats(void);
 void	test_stack(void);
 void	test_queue(void);
 
@@ -66,8 +69,25 @@ inline void check(std::string name, bool good)
 		std::cout << name << ": " << margin << FAIL << std::endl;
 };
 
-template <typename T>
-bool operator==(ft::vector<T> &a, std::vector<T> &b)
+# if FT_CXX11
+/**
+ * Value counting its copies, for the tests of the C++11 mode.
+ */
+struct copy_counter
+{
+	static int copies;
+	int value;
+
+	copy_counter(int v = 0): value(v) {}
+	copy_counter(const copy_counter &x): value(x.value) { copies++; }
+	copy_counter(copy_counter &&x) noexcept: value(x.value) { x.value = -1; }
+	copy_counter &operator=(const copy_counter &x) { value = x.value; copies++; return (*this); }
+	copy_counter &operator=(copy_counter &&x) noexcept { value = x.value; x.value = -1; return (*this); }
+};
+# endif
+
+template <typename T, typename A, typename G>
+bool operator==(ft::vector<T, A, G> &a, std::vector<T> &b)
 {
 	if (a.size() != b.size())
 		return (false);
@@ -81,6 +101,19 @@ bool operator==(ft::vector<T> &a, std::vector<T> &b)
 	return (true);
 };
 
+template <typename T, size_t N, typename A, typename G>
+bool operator==(ft::small_vector<T, N, A, G> &a, std::vector<T> &b)
+{
+	if (a.size() != b.size())
+		return (false);
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		if (a[i] != b[i])
+			return (false);
+	}
+	return (true);
+};
+
 template <typename T>
 bool operator==(ft::list<T> &a, std::list<T> &b)
 {
@@ -100,15 +133,15 @@ bool operator==(ft::list<T> &a, std::list<T> &b)
 	return (true);
 };
 
-template <typename T, typename S>
-bool operator==(ft::map<T, S> &a, std::map<T, S> &b)
+template <typename T, typename S, typename C, typename A, typename St>
+bool operator==(ft::map<T, S, C, A, St> &a, std::map<T, S, C> &b)
 {
 	if (a.size() != b.size())
 		return (false);
 	if (a.empty() != b.empty())
 		return (false);
-	typename ft::map<T, S>::iterator it = a.begin();
-	typename std::map<T, S>::iterator it2 = b.begin();
+	typename ft::map<T, S, C, A, St>::iterator it = a.begin();
+	typename std::map<T, S, C>::iterator it2 = b.begin();
 	while (it != a.end())
 	{
 		if (it->first != it2->first || it->second != it2->second)
@@ -1,4 +1,17 @@
 #include "./tests.hpp"
+#include "../../vector/mmapAllocator.hpp"
+#include "../../vector/hugePageAllocator.hpp"
+#include "../../vector/segmentedVector.hpp"
+#include "../../vector/soaVector.hpp"
+#include "../../vector/setAlgorithms.hpp"
+#include "../../vector/parallel.hpp"
+#include "../../vector/sort.hpp"
+#include "../../vector/cowVector.hpp"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <iterator>
+#include <sstream>
 
 template <typename T>
 static void print_vector(T vec, std::string type)
@@ -268,8 +281,1005 @@ static void operators(void)
 	check("v1 < v2", (v1 < v3), (v2 < v4));
 	check("v1 >= v2", (v1 >= v3), (v2 >= v4));
 	check("v1 <= v2", (v1 <= v3), (v2 <= v4));
+	const ft::vector<int> &c1 = v1;
+	ft::vector<int>::const_iterator cit = c1.begin() + 3;
+	check("(const_iterator) end <= it", c1.end() <= cit, false);
+	check("(const_iterator) it <= end", cit <= c1.end(), true);
+	check("(const_iterator) it - 2", *(cit - 2), 2);
+	check("(iterator) += -= size_t offset", *((v1.end() -= (size_t)4) += (size_t)1), 2);
 }
 
+struct record
+{
+	int		id;
+	double	value;
+	record(int i = 0): id(i), value(i * 0.5) {}
+	bool operator!=(const record &r) const { return (id != r.id || value != r.value); }
+};
+
+static void relocation(void)
+{
+	print_header("Trivially relocatable");
+	ft::vector<record> v1;
+	std::vector<record> v2;
+	ft::vector<std::string> v3;
+	std::vector<std::string> v4;
+	check("is_trivially_copyable<record>", ft::is_trivially_copyable<record>::value);
+	check("!is_trivially_copyable<string>", !ft::is_trivially_copyable<std::string>::value);
+	for (int i = 0; i < 1000; i++)
+	{
+		v1.push_back(record(i));
+		v2.push_back(record(i));
+		v3.push_back(std::string(i % 50, 'a'));
+		v4.push_back(std::string(i % 50, 'a'));
+	}
+	v1.insert(v1.begin() + 10, record(-1));
+	v2.insert(v2.begin() + 10, record(-1));
+	v3.insert(v3.begin() + 10, "inserted");
+	v4.insert(v4.begin() + 10, "inserted");
+	check("v1 == v2", v1 == v2);
+	check("v3 == v4", v3 == v4);
+	ft::vector<record> v5(v1);
+	ft::vector<std::string> v6(v3);
+	check("(copy) v5 == v2", v5 == v2);
+	check("(copy) v6 == v4", v6 == v4);
+	v5.assign(v2.begin(), v2.begin() + 5);
+	v6.assign(v3.begin(), v3.begin());
+	check("(assign) v5.size()", v5.size(), (size_t)5);
+	check("(assign) v6.empty()", v6.empty());
+}
+
+static void mmap_allocator(void)
+{
+	print_header("Mmap allocator");
+	ft::vector<int, ft::mmap_allocator<int> > v1;
+	std::vector<int> v2;
+	ft::mmap_allocator<int> alloc;
+	int *p;
+	for (int i = 0; i < 3000000; i++)
+	{
+		v1.push_back(i);
+		v2.push_back(i);
+	}
+	check("v1.size() == v2.size()", v1.size(), v2.size());
+	check("v1[2999999] == v2[2999999]", v1[2999999], v2[2999999]);
+	check("v1 == v2", std::equal(v2.begin(), v2.end(), &v1[0]));
+	p = alloc.allocate(1 << 20);
+	p[(1 << 20) - 1] = 42;
+	p = alloc.reallocate(p, 1 << 20, 1 << 22);
+	check("reallocate() keeps the content", p != NULL && p[(1 << 20) - 1] == 42);
+	alloc.deallocate(p, 1 << 22);
+	check("reallocate() small block", alloc.reallocate(&v1[0], 10, 1 << 22) == NULL);
+}
+
+template <class Vector>
+static size_t count_reallocations(Vector &v, int n)
+{
+	size_t	reallocations = 0;
+	size_t	capacity = v.capacity();
+
+	for (int i = 0; i < n; i++)
+	{
+		v.push_back(i);
+		if (v.capacity() != capacity)
+			reallocations++;
+		capacity = v.capacity();
+	}
+	return (reallocations);
+}
+
+static void growth_policy(void)
+{
+	print_header("Growth policy");
+	ft::vector<int> v1;
+	ft::vector<int, std::allocator<int>, ft::grow_half> v2;
+	ft::vector<int, std::allocator<int>, ft::grow_chunk<64> > v3;
+	ft::vector<int, std::allocator<int>, ft::grow_size_class> v4;
+	std::vector<int> v5;
+	check("(double) reallocations", count_reallocations(v1, 1000), (size_t)11);
+	check("(half) reallocations", count_reallocations(v2, 1000), (size_t)16);
+	check("(chunk) reallocations", count_reallocations(v3, 1000), (size_t)16);
+	check("(size class) reallocations", count_reallocations(v4, 1000) <= 11);
+	count_reallocations(v5, 1000);
+	check("(double) capacity", v1.capacity(), (size_t)1024);
+	check("(chunk) capacity", v3.capacity(), (size_t)1024);
+	check("(size class) capacity % 4 == 2", v4.capacity() % 4, (size_t)2);
+	check("v1 == v5", v1 == v5);
+	check("v2 == v5", v2 == v5);
+	check("v3 == v5", v3 == v5);
+	check("v4 == v5", v4 == v5);
+}
+
+static void bulk_insert_erase(void)
+{
+	print_header("Bulk insert / erase");
+	ft::vector<std::string> v1;
+	std::vector<std::string> v2;
+	ft::vector<int> v3;
+	std::vector<int> v4;
+	std::vector<int> src;
+	for (int i = 0; i < 1000; i++)
+		src.push_back(i);
+	v3.insert(v3.begin(), src.begin(), src.end());
+	v4.insert(v4.begin(), src.begin(), src.end());
+	check("capacity after range insert", v3.capacity(), (size_t)1000);
+	v3.insert(v3.begin() + 500, src.begin(), src.begin() + 10);
+	v4.insert(v4.begin() + 500, src.begin(), src.begin() + 10);
+	v3.insert(v3.end(), 3, v3.front());
+	v4.insert(v4.end(), 3, v4.front());
+	v3.insert(v3.begin(), 5, v3.back());
+	v4.insert(v4.begin(), 5, v4.back());
+	check("v3 == v4", v3 == v4);
+	check("erase(first, last)", *v3.erase(v3.begin() + 10, v3.begin() + 900), *v4.erase(v4.begin() + 10, v4.begin() + 900));
+	ft::vector<int>::iterator it = v3.erase(v3.end() - 1);
+	check("erase(end - 1)", it == v3.end());
+	v4.erase(v4.end() - 1);
+	check("v3 == v4", v3 == v4);
+	for (int i = 0; i < 100; i++)
+	{
+		v1.push_back(std::string(i % 30, 'a' + i % 26));
+		v2.push_back(std::string(i % 30, 'a' + i % 26));
+	}
+	std::vector<std::string> extra(v2.begin(), v2.begin() + 20);
+	v1.insert(v1.begin() + 50, extra.begin(), extra.end());
+	v2.insert(v2.begin() + 50, extra.begin(), extra.end());
+	v1.insert(v1.begin() + 3, 7, "fill");
+	v2.insert(v2.begin() + 3, 7, "fill");
+	check("v1 == v2", v1 == v2);
+	v1.erase(v1.begin() + 1, v1.begin() + 60);
+	v2.erase(v2.begin() + 1, v2.begin() + 60);
+	v1.erase(v1.begin());
+	v2.erase(v2.begin());
+	check("v1 == v2", v1 == v2);
+	ft::vector<std::string>::iterator it2 = v1.erase(v1.begin(), v1.begin());
+	check("erase(first, first)", it2 == v1.begin());
+	check("v1 size", v1.size(), v2.size());
+}
+
+static size_t g_allocations = 0;
+
+template <class T>
+struct counting_allocator: public std::allocator<T>
+{
+	template <class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator(void) {}
+	template <class U>
+	counting_allocator(const counting_allocator<U> &) {}
+
+	T *allocate(size_t n, const void * = 0)
+	{
+		g_allocations++;
+		return (std::allocator<T>::allocate(n));
+	}
+};
+
+static void small_vector(void)
+{
+	print_header("Small vector");
+	typedef ft::small_vector<int, 8, counting_allocator<int> > small;
+	g_allocations = 0;
+	{
+		small v1;
+		for (int i = 0; i < 5; i++)
+			v1.push_back(i);
+		v1.insert(v1.begin() + 2, 3, 42);
+		v1.erase(v1.begin(), v1.begin() + 3);
+		small v2(v1);
+		small v3;
+		v3 = v2;
+		v3.swap(v1);
+		check("no allocation up to N", g_allocations, (size_t)0);
+		check("is_inline()", v1.is_inline() && v2.is_inline());
+	}
+	ft::small_vector<std::string, 4> v4;
+	std::vector<std::string> v5;
+	for (int i = 0; i < 100; i++)
+	{
+		v4.push_back(std::string(i % 20, 'a' + i % 26));
+		v5.push_back(std::string(i % 20, 'a' + i % 26));
+	}
+	check("!is_inline() after overflow", !v4.is_inline());
+	check("v4 == v5", v4 == v5);
+	std::vector<std::string> extra(v5.begin() + 50, v5.end());
+	v4.insert(v4.begin() + 1, extra.begin(), extra.end());
+	v5.insert(v5.begin() + 1, extra.begin(), extra.end());
+	v4.erase(v4.begin() + 3, v4.end() - 2);
+	v5.erase(v5.begin() + 3, v5.end() - 2);
+	check("v4 == v5", v4 == v5);
+	ft::small_vector<std::string, 4> v6(3, "x");
+	v6.swap(v4);
+	check("swap(inline, heap)", v6 == v5 && v4.size() == 3 && v4[2] == "x");
+	v6.resize(2);
+	ft::small_vector<std::string, 4> v7(v6);
+	check("copy fits inline", v7.is_inline() && v7 == v6);
+	v7.resize(1);
+	v6.assign(v7.begin(), v7.end());
+	check("assign", v6 == v7);
+	check("v6 < v4", v6 < v4, std::string("") < std::string("x"));
+	std::istringstream in1("1 2 3 4 5 6");
+	std::istringstream in2("7 8");
+	ft::small_vector<int, 4> v8((std::istream_iterator<int>(in1)), std::istream_iterator<int>());
+	v8.insert(v8.begin() + 1, std::istream_iterator<int>(in2), std::istream_iterator<int>());
+	check("(istream) construct / insert", v8.size() == 8 && v8[1] == 7 && v8[2] == 8 && v8[7] == 6);
+}
+
+struct no_default
+{
+	int	value;
+	explicit no_default(int v): value(v) {}
+	bool operator==(const no_default &x) const { return (value == x.value); }
+};
+
+static void static_vector(void)
+{
+	print_header("Static vector");
+	ft::static_vector<std::string, 4> v1;
+	ft::static_vector<int, 3, ft::overflow_return_false> v2;
+	ft::static_vector<no_default, 2> v3;
+	bool thrown = false;
+	v1.push_back("a");
+	v1.push_back("b");
+	v1.insert(v1.begin(), 2, "c");
+	check("v1 full", v1.full() && v1.size() == 4 && v1[0] == "c" && v1[3] == "b");
+	try
+	{
+		v1.push_back("d");
+	}
+	catch (std::length_error &e)
+	{
+		thrown = true;
+	}
+	check("overflow_throw", thrown && v1.size() == 4);
+	check("push_back", v2.push_back(1) && v2.push_back(2) && v2.push_back(3));
+	check("push_back when full", !v2.push_back(4) && v2.size() == 3);
+	check("insert when full", v2.insert(v2.begin(), 0) == v2.end());
+	v2.erase(v2.begin());
+	check("insert", *v2.insert(v2.begin(), 0) == 0 && v2[1] == 2);
+	check("resize past capacity", !v2.resize(4) && v2.size() == 3);
+	v3.push_back(no_default(7));
+	check("no default construction", v3.size() == 1 && v3[0].value == 7);
+	ft::static_vector<std::string, 4> v4(v1);
+	v4.erase(v4.begin() + 1, v4.end() - 1);
+	v4.swap(v1);
+	check("copy / swap", v4.size() == 4 && v1.size() == 2 && v1[1] == "b");
+	check("v1 < v4", v1 < v4 && !(v4 < v1));
+	ft::static_vector<int, 3, ft::overflow_return_false> v5;
+	std::istringstream in1("1 2");
+	std::istringstream in2("3 4");
+	std::istringstream in3("5");
+	check("(istream) assign", v5.assign(std::istream_iterator<int>(in1), std::istream_iterator<int>()) && v5.size() == 2);
+	check("(istream) insert past capacity", !v5.insert(v5.begin(), std::istream_iterator<int>(in2), std::istream_iterator<int>()) && v5.size() == 2 && v5[1] == 2);
+	check("(istream) insert", v5.insert(v5.begin(), std::istream_iterator<int>(in3), std::istream_iterator<int>()) && v5[0] == 5 && v5[2] == 2);
+}
+
+static void resize_init(void)
+{
+	print_header("Resize / fill");
+	ft::vector<int> v1(1000, -1);
+	std::vector<int> v2(1000, -1);
+	ft::vector<record> v3;
+	std::vector<record> v4;
+	ft::vector<std::string> v5;
+	check("fill constructor", v1 == v2);
+	v1.resize(3000, 0x01020304);
+	v2.resize(3000, 0x01020304);
+	v1.resize(2000);
+	v2.resize(2000);
+	check("resize(n, val)", v1 == v2);
+	v1.assign(10, 0);
+	v2.assign(10, 0);
+	v1.insert(v1.begin() + 5, 100, 7);
+	v2.insert(v2.begin() + 5, 100, 7);
+	check("assign / insert", v1 == v2);
+	v3.resize(50, record(3));
+	v4.resize(50, record(3));
+	check("resize(n, record)", v3 == v4);
+	v1.resize_uninitialized(5000);
+	check("resize_uninitialized size", v1.size(), (size_t)5000);
+	check("resize_uninitialized keeps content", v1[0] == 0 && v1[5] == 7 && v1[109] == 0);
+	for (size_t i = 0; i < v1.size(); i++)
+		v1[i] = i;
+	v1.resize_default_init(10);
+	check("resize_default_init shrink", v1.size() == 10 && v1[9] == 9);
+	v5.push_back("a");
+	v5.resize_default_init(3);
+	check("resize_default_init(string)", v5.size() == 3 && v5[0] == "a" && v5[2].empty());
+	check("trivially default constructible", ft::is_trivially_default_constructible<int>::value && !ft::is_trivially_default_constructible<std::string>::value);
+}
+
+static void huge_page_allocator(void)
+{
+	print_header("Huge page allocator");
+	ft::huge_page_allocator<double> alloc;
+	ft::huge_page_allocator<double> interleave(ft::numa_interleave);
+	ft::huge_page_allocator<double> hugetlb(ft::numa_bind, 1UL, true);
+	ft::vector<double, ft::huge_page_allocator<double> > v1(interleave);
+	std::vector<double> v2;
+	double *p;
+	for (int i = 0; i < 1000000; i++)
+	{
+		v1.push_back(i * 0.5);
+		v2.push_back(i * 0.5);
+	}
+	check("v1 == v2", std::equal(v2.begin(), v2.end(), &v1[0]));
+	p = alloc.allocate(1 << 20);
+	check("block aligned on a huge page", reinterpret_cast<size_t>(p) % (1 << 21), (size_t)0);
+	p[(1 << 20) - 1] = 42;
+	check("block usable", p[(1 << 20) - 1] == 42);
+	alloc.deallocate(p, 1 << 20);
+	p = hugetlb.allocate(1 << 20);
+	p[0] = 1;
+	p[(1 << 20) - 1] = 2;
+	check("hugetlb / bind fallback", p[0] + p[(1 << 20) - 1] == 3);
+	interleave.deallocate(p, 1 << 20);
+	p = alloc.allocate(10);
+	p[9] = 1;
+	alloc.deallocate(p, 10);
+	check("rebind keeps the policy", ft::huge_page_allocator<int>(interleave).policy() == ft::numa_interleave);
+}
+
+static void segmented_vector(void)
+{
+	print_header("Segmented vector");
+	ft::segmented_vector<int> v1;
+	std::vector<int> v2;
+	std::vector<int *> addresses;
+	bool stable = true;
+	for (int i = 0; i < 100000; i++)
+	{
+		v1.push_back(i);
+		v2.push_back(i);
+		if (i % 1000 == 0)
+			addresses.push_back(&v1.back());
+	}
+	for (size_t i = 0; i < addresses.size(); i++)
+		if (addresses[i] != &v1[i * 1000])
+			stable = false;
+	check("elements never move", stable);
+	check("v1 == v2", std::equal(v2.begin(), v2.end(), v1.begin()));
+	check("operator[]", v1[65535], v2[65535]);
+	check("capacity", v1.capacity() >= v1.size() && v1.capacity() < 2 * v1.size() + 16);
+	ft::segmented_vector<int>::iterator it = v1.begin() + 40000;
+	ft::segmented_vector<int>::const_iterator cit = it;
+	check("iterator arithmetic", *(it + 5) == 40005 && it[-3] == 39997 && cit - v1.begin() == 40000);
+	check("reverse iterator", *v1.rbegin(), 99999);
+	v1.resize(10);
+	check("resize", v1.size() == 10 && v1.back() == 9 && addresses[0] == &v1[0]);
+	ft::segmented_vector<std::string, std::allocator<std::string>, 4> v3(20, "abc");
+	ft::segmented_vector<std::string, std::allocator<std::string>, 4> v4(v3);
+	v4.push_back("last");
+	v3.swap(v4);
+	check("copy / swap", v3.size() == 21 && v4.size() == 20 && v3.back() == "last" && v3 > v4);
+	check("at()", v4.at(19) == "abc");
+	ft::segmented_vector<int> v5(3, 5);
+	ft::segmented_vector<int>::iterator first = v1.begin();
+	ft::segmented_vector<int>::iterator other = v5.begin();
+	v1.swap(v5);
+	check("(swap) iterators follow elements", *first == 0 && first + 10 == v5.end() && *other == 5 && other + 3 == v1.end());
+}
+
+static void search(void)
+{
+	print_header("Search");
+	ft::vector<int> v1;
+	std::vector<int> v2;
+	ft::vector<double> v3;
+	ft::vector<std::string> v4;
+	for (int i = 0; i < 1000; i++)
+	{
+		v1.push_back((i * 7919) % 1009 - 500);
+		v2.push_back((i * 7919) % 1009 - 500);
+	}
+	check("find", v1.find(42) - v1.begin(), std::find(v2.begin(), v2.end(), 42) - v2.begin());
+	check("find missing", v1.find(100000) == v1.end());
+	check("count", v1.count(-3), (size_t)std::count(v2.begin(), v2.end(), -3));
+	check("contains", v1.contains(499) && !v1.contains(509));
+	check("min", v1.min(), *std::min_element(v2.begin(), v2.end()));
+	check("max", v1.max(), *std::max_element(v2.begin(), v2.end()));
+	ft::vector<int> v5(v1);
+	check("v1 == v5", v1 == v5 && !(v1 < v5) && !(v1 > v5));
+	v5[999]++;
+	check("v1 < v5", v1 < v5 && v5 > v1 && v1 != v5);
+	v5.pop_back();
+	check("v5 < v1", v5 < v1 && v1 > v5);
+	v3.push_back(-0.0);
+	v3.push_back(1.5);
+	v3.push_back(0.0 / 0.0);
+	check("find(0.0) matches -0.0", v3.find(0.0) == v3.begin() && v3.count(0.0) == 1);
+	check("find(NaN)", !v3.contains(v3[2]) && v3.contains(1.5));
+	check("v3 != v3 (NaN)", v3 != v3);
+	v4.push_back("b");
+	v4.push_back("a");
+	check("string find / min", *v4.find("a") == "a" && v4.min() == "a" && v4.max() == "b");
+}
+
+static void	copy_assignment(void)
+{
+	print_header("Copy assignment");
+	typedef ft::vector<int, counting_allocator<int> > counted;
+	counted v1;
+	for (int i = 0; i < 100; i++)
+		v1.push_back(i);
+
+	g_allocations = 0;
+	counted v2(v1);
+	check("(copy ctor) one allocation", g_allocations, (size_t)1);
+	check("(copy ctor) v2 == v1", v2 == v1);
+	check("(copy ctor) v2.capacity()", v2.capacity(), (size_t)100);
+
+	counted v3;
+	g_allocations = 0;
+	v3 = v1;
+	check("(grow) one allocation", g_allocations, (size_t)1);
+	v3[0] = 42;
+	check("(deep copy) v1[0] untouched", v1[0], 0);
+	int *data = &v3[0];
+	v1.resize(10);
+	g_allocations = 0;
+	v3 = v1;
+	check("(shrink) no allocation", g_allocations, (size_t)0);
+	check("(shrink) storage reused", &v3[0] == data && v3 == v1);
+	v3 = v3;
+	check("(self) v3 == v1", v3 == v1);
+
+	ft::vector<std::string> v4(3, "abc");
+	ft::vector<std::string> v5(5, "defghijklmnopqrstuvwxyz0123456789");
+	std::vector<std::string> v6(3, "abc");
+	v5 = v4;
+	check("(string, shrink) v5 == v4", v5 == v6);
+	v4.push_back("x");
+	v4.push_back("y");
+	v4.push_back("z");
+	v6.push_back("x");
+	v6.push_back("y");
+	v6.push_back("z");
+	v5 = v4;
+	check("(string, grow) v5 == v4", v5 == v6);
+	v5[0][0] = 'z';
+	check("(string) deep copy", v4[0], std::string("abc"));
+}
+
+static void	range_category(void)
+{
+	print_header("Range category");
+	typedef ft::vector<int, counting_allocator<int> > counted;
+	int a[] = {5, 4, 3, 2, 1, 0, 1, 2, 3, 4, 5, 6, 7};
+	std::vector<int> ref(a, a + 13);
+	std::list<int> l(a, a + 13);
+
+	g_allocations = 0;
+	counted v1(a, a + 13);
+	check("(pointers) one allocation", g_allocations, (size_t)1);
+	g_allocations = 0;
+	counted v2(l.begin(), l.end());
+	check("(list) one allocation", g_allocations, (size_t)1);
+	check("(list) v2 == ref", v2 == ref);
+	g_allocations = 0;
+	v1.assign(v2.rbegin(), v2.rend());
+	check("(reverse, fits) no allocation", g_allocations, (size_t)0);
+	check("(reverse) v1.front()", v1.front(), 7);
+
+	std::istringstream in1("1 2 3 4 5 6 7 8 9 10");
+	ft::vector<int> v3((std::istream_iterator<int>(in1)), std::istream_iterator<int>());
+	std::istringstream in2("1 2 3 4 5 6 7 8 9 10");
+	std::vector<int> v4((std::istream_iterator<int>(in2)), std::istream_iterator<int>());
+	check("(istream) v3 == v4", v3 == v4);
+	std::istringstream in3("42 43 44");
+	v3.assign(std::istream_iterator<int>(in3), std::istream_iterator<int>());
+	check("(istream, assign) v3.size()", v3.size(), (size_t)3);
+	std::istringstream in4("-1 -2");
+	std::istringstream in5("-1 -2");
+	v3.insert(v3.begin() + 1, std::istream_iterator<int>(in4), std::istream_iterator<int>());
+	v4.assign(3, 0);
+	v4[0] = 42; v4[1] = 43; v4[2] = 44;
+	v4.insert(v4.begin() + 1, std::istream_iterator<int>(in5), std::istream_iterator<int>());
+	check("(istream, insert) v3 == v4", v3 == v4);
+}
+
+static void	shrink_to_fit(void)
+{
+	print_header("Shrink to fit");
+	ft::vector<int> v1;
+	for (int i = 0; i < 1000; i++)
+		v1.push_back(i);
+	v1.resize(10);
+	check("(after burst) v1.capacity() >= 1000", v1.capacity() >= 1000);
+	v1.shrink_to_fit();
+	check("v1.capacity()", v1.capacity(), (size_t)10);
+	check("v1.memory_usage()", v1.memory_usage(), 10 * sizeof(int));
+	check("(kept) v1[9]", v1[9], 9);
+	v1.reserve_exact(100);
+	check("(grow) v1.capacity()", v1.capacity(), (size_t)100);
+	v1.reserve_exact(5);
+	check("(below size) v1.capacity()", v1.capacity(), (size_t)10);
+	v1.clear();
+	v1.shrink_to_fit();
+	check("(empty) v1.memory_usage()", v1.memory_usage(), (size_t)0);
+	v1.push_back(42);
+	check("(reuse) v1.back()", v1.back(), 42);
+
+	ft::vector<std::string> v2(100, "some string");
+	v2.erase(v2.begin() + 3, v2.end());
+	v2.shrink_to_fit();
+	check("(string) v2.capacity()", v2.capacity(), (size_t)3);
+	check("(string) v2[2]", v2[2], std::string("some string"));
+}
+
+static void	bool_vector(void)
+{
+	print_header("Vector<bool>");
+	ft::vector<bool> v1;
+	std::vector<bool> v2;
+	for (int i = 0; i < 1000; i++)
+	{
+		v1.push_back(i % 3 == 0 || i % 7 == 0);
+		v2.push_back(i % 3 == 0 || i % 7 == 0);
+	}
+	check("v1 == v2", v1 == v2);
+	check("(packed) v1.memory_usage()", v1.memory_usage() <= v1.capacity() / 8);
+	check("v1.count()", v1.count(), (size_t)std::count(v2.begin(), v2.end(), true));
+	check("v1.count(false)", v1.count(false), (size_t)std::count(v2.begin(), v2.end(), false));
+
+	size_t n = 0;
+	bool ordered = true;
+	for (size_t i = v1.find_first(); i < v1.size(); i = v1.find_next(i), n++)
+		ordered = ordered && v2[i];
+	check("(find_first / find_next) visits", n, v1.count());
+	check("(find_next) only true elements", ordered);
+	check("find_next(999) == size()", v1.find_next(999), v1.size());
+
+	v1[1] = true;
+	v2[1] = true;
+	v1[0].flip();
+	v2[0].flip();
+	v1.insert(v1.begin() + 5, 70, true);
+	v2.insert(v2.begin() + 5, 70, true);
+	v1.insert(v1.begin() + 64, false);
+	v2.insert(v2.begin() + 64, false);
+	v1.erase(v1.begin() + 10, v1.begin() + 200);
+	v2.erase(v2.begin() + 10, v2.begin() + 200);
+	v1.pop_back();
+	v2.pop_back();
+	v1.resize(1200, true);
+	v2.resize(1200, true);
+	check("(insert / erase / resize) v1 == v2", v1 == v2);
+	check("(insert / erase / resize) count", v1.count(), (size_t)std::count(v2.begin(), v2.end(), true));
+	check("(reverse) *v1.rbegin()", (bool)*v1.rbegin(), (bool)*v2.rbegin());
+	v1.resize(130);
+	v2.resize(130);
+	check("(shrink) v1 == v2", v1 == v2);
+	check("(shrink) count", v1.count(), (size_t)std::count(v2.begin(), v2.end(), true));
+
+	ft::vector<bool> a(200, false);
+	ft::vector<bool> b(200, false);
+	for (size_t i = 0; i < 200; i += 2)
+		a[i] = true;
+	for (size_t i = 0; i < 200; i += 3)
+		b[i] = true;
+	ft::vector<bool> c(a);
+	c &= b;
+	check("(&=) count", c.count(), (size_t)34);
+	c = a;
+	c |= b;
+	check("(|=) count", c.count(), (size_t)133);
+	c = a;
+	c ^= b;
+	check("(^=) count", c.count(), (size_t)99);
+	c.flip();
+	check("(flip) count", c.count(), (size_t)101);
+	check("a < b / !(b < a)", !(a < b) && b < a);
+	ft::vector<bool> d(a.begin(), a.begin() + 100);
+	check("(range ctor) d < a", d < a && d.size() == 100 && d.count() == 50);
+}
+
+struct throwing_copy
+{
+	static bool	fail;
+	throwing_copy(void) {}
+	throwing_copy(const throwing_copy &) { if (fail) throw std::runtime_error("copy"); }
+	throwing_copy &operator=(const throwing_copy &) { return (*this); }
+};
+
+bool	throwing_copy::fail = false;
+
+static void	soa_vector(void)
+{
+	print_header("Structure of arrays");
+	ft::soa_vector<int, double, std::string> v1;
+	std::vector<int> ids;
+	std::vector<double> prices;
+	v1.reserve(10);
+	for (int i = 0; i < 1000; i++)
+	{
+		v1.push_back(i, i * 0.5, i % 2 ? "odd" : "even");
+		ids.push_back(i);
+		prices.push_back(i * 0.5);
+	}
+	check("v1.size()", v1.size(), (size_t)1000);
+	ft::soa_span<double> col = v1.column<1>();
+	double sum = 0;
+	for (size_t i = 0; i < col.size(); i++)
+		sum += col[i];
+	check("(column) sum", sum, 249750.0);
+	check("(column) contiguous", &col[999] - &col[0] == 999);
+	check("(row) v1[3].get<2>()", v1[3].get<2>(), std::string("odd"));
+	v1[3].get<0>() = 42;
+	check("(row write) v1.get<0>(3)", v1.get<0>(3), 42);
+	v1.erase(0);
+	v1.pop_back();
+	check("(erase / pop_back) v1.size()", v1.size(), (size_t)998);
+	check("(erase) v1[0] fields", v1[0].get<0>() == 1 && v1[0].get<1>() == 0.5 && v1[0].get<2>() == "odd");
+	check("(erase) columns agree", v1.column<0>().size() == v1.column<2>().size() && v1.get<1>(997) == 499.0);
+	v1.resize(2000);
+	check("(resize) v1.get<1>(1999)", v1.get<1>(1999), 0.0);
+	check("v1.memory_usage()", v1.memory_usage() >= 2000 * (sizeof(int) + sizeof(double) + sizeof(std::string)));
+
+	ft::soa_vector<int, double, std::string> v2(v1);
+	v1.clear();
+	check("(copy) v2.size() / v1.empty()", v2.size() == 2000 && v1.empty());
+	v1.swap(v2);
+	const ft::soa_vector<int, double, std::string> &v3 = v1;
+	check("(const) v3[1].get<0>()", v3[1].get<0>(), 2);
+	check("(const) v3.column<1>()[1]", v3.column<1>()[1], 1.0);
+	v1.shrink_to_fit();
+	check("(shrink) v1.capacity()", v1.capacity(), (size_t)2000);
+
+	ft::soa_vector<int, double, throwing_copy> v4;
+	v4.reserve(200);
+	v4.push_back(1, 1.0);
+	throwing_copy::fail = true;
+	try { v4.push_back(2, 2.0); } catch (std::exception &) {}
+	try { v4.resize(100); } catch (std::exception &) {}
+	throwing_copy::fail = false;
+	v4.push_back(3, 3.0);
+	check("(throw) columns stay aligned", v4.size() == 2 && v4.get<0>(1) == 3 && v4.get<1>(1) == 3.0);
+}
+
+//a string whose copy throws once copies_left reaches zero, counting the live objects
+struct throwing_string
+{
+	static int	copies_left;
+	static int	live;
+	std::string	value;
+
+	throwing_string(const char *s = ""): value(s) { live++; }
+	throwing_string(const throwing_string &x): value(x.value)
+	{
+		if (copies_left >= 0 && copies_left-- == 0)
+			throw std::runtime_error("copy");
+		live++;
+	}
+	~throwing_string(void) { live--; }
+	throwing_string &operator=(const throwing_string &x) { value = x.value; return (*this); }
+};
+
+int	throwing_string::copies_left = -1;
+int	throwing_string::live = 0;
+
+static void	exception_safety(void)
+{
+	print_header("Exception safety");
+	{
+		ft::vector<throwing_string> v;
+		v.reserve(5);
+		for (int i = 0; i < 5; i++)
+			v.push_back(std::string(1, (char)('a' + i)).c_str());
+		throwing_string::copies_left = 2;
+		try { v.reserve(100); } catch (std::runtime_error &) {}
+		check("(reserve) unchanged", v.size() == 5 && v.capacity() == 5 && v[4].value == "e" && throwing_string::live == 5);
+		throwing_string::copies_left = 3;
+		try { v.insert(v.begin() + 2, (size_t)2, throwing_string("x")); } catch (std::runtime_error &) {}
+		check("(insert) unchanged", v.size() == 5 && v[2].value == "c" && throwing_string::live == 5);
+		throwing_string::copies_left = 3;
+		try { ft::vector<throwing_string> copy(v); } catch (std::runtime_error &) {}
+		throwing_string::copies_left = 3;
+		try { ft::vector<throwing_string> filled(10, v[0]); } catch (std::runtime_error &) {}
+		ft::vector<throwing_string> small;
+		throwing_string::copies_left = 3;
+		try { small = v; } catch (std::runtime_error &) {}
+		check("(copy / fill / =) nothing leaked", small.empty() && throwing_string::live == 5);
+		throwing_string::copies_left = -1;
+		v.insert(v.begin() + 1, throwing_string("y"));
+		check("(insert) v[1]", v[1].value == "y" && v[2].value == "b" && v.size() == 6);
+	}
+	check("every element destroyed", throwing_string::live, 0);
+}
+
+static void	set_algorithms(void)
+{
+	print_header("Set algorithms");
+	ft::vector<unsigned int> a;
+	ft::vector<unsigned int> b;
+	ft::vector<unsigned int> skewed;
+	std::vector<unsigned int> sa;
+	std::vector<unsigned int> sb;
+	std::vector<unsigned int> sskewed;
+	for (unsigned int i = 0; i < 5000; i++)
+	{
+		if (i % 3 == 0 || i % 5 == 0)
+		{
+			a.push_back(i);
+			sa.push_back(i);
+		}
+		if (i % 2 == 0 || i % 7 == 0)
+		{
+			b.push_back(i);
+			sb.push_back(i);
+		}
+		if (i % 97 == 0)
+		{
+			skewed.push_back(i);
+			sskewed.push_back(i);
+		}
+	}
+	std::vector<unsigned int> out(20000);
+	std::vector<unsigned int> ref(20000);
+	size_t n;
+	size_t m;
+
+	n = ft::merge(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+	m = std::merge(sa.begin(), sa.end(), sb.begin(), sb.end(), ref.begin()) - ref.begin();
+	check("merge", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+	n = ft::set_union(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+	m = std::set_union(sa.begin(), sa.end(), sb.begin(), sb.end(), ref.begin()) - ref.begin();
+	check("set_union", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+	n = ft::set_difference(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+	m = std::set_difference(sa.begin(), sa.end(), sb.begin(), sb.end(), ref.begin()) - ref.begin();
+	check("set_difference", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+	n = ft::set_intersection(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+	m = std::set_intersection(sa.begin(), sa.end(), sb.begin(), sb.end(), ref.begin()) - ref.begin();
+	check("set_intersection", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+	n = ft::set_intersection_unique(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+	check("(simd) set_intersection_unique", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+	n = ft::set_intersection(skewed.begin(), skewed.end(), a.begin(), a.end(), out.begin()) - out.begin();
+	m = std::set_intersection(sskewed.begin(), sskewed.end(), sa.begin(), sa.end(), ref.begin()) - ref.begin();
+	check("(gallop) set_intersection", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+	n = ft::set_intersection(a.begin(), a.end(), skewed.begin(), skewed.end(), out.begin()) - out.begin();
+	check("(gallop, swapped) set_intersection", n == m && std::equal(out.begin(), out.begin() + n, ref.begin()));
+
+	int dup1[] = {1, 2, 2, 2, 3, 5, 5, 8};
+	int dup2[] = {2, 2, 5, 5, 5, 7, 8, 8};
+	std::list<int> l(dup2, dup2 + 8);
+	ft::vector<int> r;
+	std::vector<int> sr;
+	ft::set_intersection(dup1, dup1 + 8, l.begin(), l.end(), std::back_inserter(r));
+	std::set_intersection(dup1, dup1 + 8, dup2, dup2 + 8, std::back_inserter(sr));
+	check("(duplicates, list) set_intersection", r == sr);
+	r.clear();
+	sr.clear();
+	ft::set_union(dup1, dup1 + 8, dup2, dup2 + 8, std::back_inserter(r), std::less<int>());
+	std::set_union(dup1, dup1 + 8, dup2, dup2 + 8, std::back_inserter(sr));
+	check("(duplicates) set_union", r == sr);
+}
+
+struct	sort_item
+{
+	int	key;
+	int	order;
+};
+
+static bool	key_less(const sort_item &a, const sort_item &b)
+{
+	return (a.key < b.key);
+}
+
+static bool	stably_sorted(const ft::vector<sort_item> &v)
+{
+	for (size_t i = 1; i < v.size(); i++)
+	{
+		if (v[i].key < v[i - 1].key || (v[i].key == v[i - 1].key && v[i].order < v[i - 1].order))
+			return (false);
+	}
+	return (true);
+}
+
+static void	sort(void)
+{
+	print_header("Sort");
+	ft::vector<int>				v;
+	ft::vector<long long>		l;
+	ft::vector<std::string>		s;
+	ft::vector<sort_item>		items;
+	std::vector<int>			ref;
+	std::vector<long long>		lref;
+	std::vector<std::string>	sref;
+
+	for (int i = 0; i < 5000; i++)
+	{
+		v.push_back((i * 7919) % 5003 - 2500);
+		l.push_back((long long)(i % 97 - 48) * 100000000000LL + i);
+		s.push_back(std::string(1, (char)('a' + i % 26)) + (char)('a' + i % 7));
+		sort_item	item = {i % 10, i};
+		items.push_back(item);
+	}
+	ref.assign(v.begin(), v.end());
+	lref.assign(l.begin(), l.end());
+	sref.assign(s.begin(), s.end());
+	std::sort(ref.begin(), ref.end());
+	std::sort(lref.begin(), lref.end());
+	std::sort(sref.begin(), sref.end());
+
+	ft::vector<int>		small(v.begin(), v.begin() + 100);
+	std::vector<int>	small_ref(v.begin(), v.begin() + 100);
+	ft::sort(small.begin(), small.end());
+	std::sort(small_ref.begin(), small_ref.end());
+	check("(introsort) sort", std::equal(small_ref.begin(), small_ref.end(), small.begin()));
+	ft::sort(v.begin(), v.end());
+	check("(radix, int) sort", std::equal(ref.begin(), ref.end(), v.begin()));
+	ft::sort(l.begin(), l.end());
+	check("(radix, long long) sort", std::equal(lref.begin(), lref.end(), l.begin()));
+	ft::sort(s.begin(), s.end());
+	check("(string) sort", std::equal(sref.begin(), sref.end(), s.begin()));
+	ft::sort(v.begin(), v.end(), std::greater<int>());
+	check("(greater) sort", std::equal(ref.rbegin(), ref.rend(), v.begin()));
+	ft::sort(v.begin(), v.end(), std::greater<int>());
+	check("(sorted input) sort", std::equal(ref.rbegin(), ref.rend(), v.begin()));
+	ft::stable_sort(v.begin(), v.end());
+	check("(radix) stable_sort", std::equal(ref.begin(), ref.end(), v.begin()));
+	ft::stable_sort(items.begin(), items.end(), key_less);
+	check("stable_sort", stably_sorted(items));
+	int	array[] = {5, 3, 9, 1, 3, 7};
+	ft::sort(array, array + 6);
+	check("(pointers) sort", array[0] == 1 && array[1] == 3 && array[2] == 3 && array[5] == 9);
+}
+
+static int	square(int x)
+{
+	return (x * x);
+}
+
+static int	greatest(int a, int b)
+{
+	return (a < b ? b : a);
+}
+
+static void	twice(long &x)
+{
+	x *= 2;
+}
+
+static void	parallel_algorithms(void)
+{
+	print_header("Parallel algorithms");
+	ft::parallel::thread_pool	pool(4);
+	size_t						n = 300000;
+	ft::vector<int>				v(n);
+	ft::vector<int>				out(n);
+	ft::vector<long>			l(n, 1);
+	std::vector<int>			ref;
+	long						sum = 0;
+	bool						ok = true;
+
+	for (size_t i = 0; i < n; i++)
+		v[i] = (int)((i * 7919) % 10007);
+	ft::parallel::fill(pool, out.begin(), out.end(), 42);
+	check("fill", std::count(out.begin(), out.end(), 42), (long)n);
+	ft::parallel::copy(pool, v.begin(), v.end(), out.begin());
+	check("copy", out == v);
+	check("(returned) copy", ft::parallel::copy(pool, v.begin(), v.end(), out.begin()) == out.end());
+	ft::parallel::transform(pool, v.begin(), v.end(), out.begin(), square);
+	for (size_t i = 0; i < n; i++)
+		ok = ok && out[i] == v[i] * v[i];
+	check("transform", ok);
+	ft::parallel::transform(pool, v.begin(), v.end(), out.begin(), out.begin(), std::minus<int>());
+	ok = true;
+	for (size_t i = 0; i < n; i++)
+		ok = ok && out[i] == v[i] - v[i] * v[i];
+	check("(binary) transform", ok);
+	ft::parallel::for_each(pool, l.begin(), l.end(), twice);
+	check("for_each", std::count(l.begin(), l.end(), 2), (long)n);
+	for (size_t i = 0; i < n; i++)
+		sum += v[i];
+	check("reduce", ft::parallel::reduce(pool, v.begin(), v.end(), 10L), sum + 10);
+	check("(max) reduce", ft::parallel::reduce(pool, v.begin(), v.end(), 0, greatest), 10006);
+	check("(default pool) reduce", ft::parallel::reduce(v.begin(), v.end(), 0L), sum);
+	check("(sequential) reduce", ft::parallel::reduce(pool, v.begin(), v.begin() + 100, 0L),
+		std::accumulate(v.begin(), v.begin() + 100, 0L));
+	ref.assign(v.begin(), v.end());
+	std::sort(ref.begin(), ref.end());
+	ft::parallel::sort(pool, v.begin(), v.end());
+	check("sort", std::equal(ref.begin(), ref.end(), v.begin()));
+	ft::parallel::sort(pool, v.begin(), v.end(), std::greater<int>());
+	check("(greater) sort", std::equal(ref.rbegin(), ref.rend(), v.begin()));
+
+	ft::vector<sort_item>	items;
+	for (size_t i = 0; i < n; i++)
+	{
+		sort_item	item = {(int)(i * 31 % 1000), (int)i};
+		items.push_back(item);
+	}
+	ft::parallel::stable_sort(pool, items.begin(), items.end(), key_less);
+	check("stable_sort", stably_sorted(items));
+
+	//3 threads: 12 chunks, so one round merges a run with nothing
+	ft::parallel::thread_pool	odd(3);
+	ft::vector<std::string>		words;
+	std::vector<std::string>	sorted_words;
+	for (size_t i = 0; i < 50000; i++)
+		words.push_back(std::string(1, (char)('a' + i * 7 % 26)) + (char)('a' + i % 26));
+	sorted_words.assign(words.begin(), words.end());
+	std::stable_sort(sorted_words.begin(), sorted_words.end());
+	ft::parallel::stable_sort(odd, words.begin(), words.end());
+	check("(3 threads, strings) stable_sort", std::equal(sorted_words.begin(), sorted_words.end(), words.begin()));
+}
+
+static void	cow_vector(void)
+{
+	print_header("Copy-on-write vector");
+	ft::vector<int>		v;
+	for (int i = 0; i < 1000; i++)
+		v.push_back(i);
+	ft::cow_vector<int>	a(v);
+	ft::cow_vector<int>	b(a);
+	ft::cow_vector<int>	c;
+	const ft::cow_vector<int>	&cb = b;
+
+	c = b;
+	check("(shared) use_count", a.use_count(), (size_t)3);
+	check("(shared) values", &a.values() == &c.values());
+	check("(const read) values", cb[10] == 10 && cb.size() == 1000 && *(cb.end() - 1) == 999 && b.use_count() == 3);
+	b.push_back(1000);
+	check("(detached) push_back", b.size() == 1000 + 1 && a.size() == 1000 && a.use_count() == 2 && b.unique());
+	check("(detached) values", &a.values() != &b.values() && b.values()[999] == 999);
+	c[0] = -1;
+	check("(written) operator[]", c[0] == -1 && a[0] == 0 && a.unique());
+	int	&ref = c[1];
+	ft::cow_vector<int>	d(c);
+	ref = -2;
+	check("(leaked reference) copy", d[1] == 1 && c[1] == -2);
+	c.assign(5, 7);
+	ft::cow_vector<int>	e(c);
+	check("(shared again) assign", e.use_count() == 2 && e[4] == 7);
+	e.clear();
+	check("clear", e.empty() && c.size() == 5 && c.unique());
+	e.swap(c);
+	check("swap", e.size() == 5 && c.empty());
+	check("operator==", a == ft::cow_vector<int>(v) && a != b && a < b);
+	ft::cow_vector<int>::iterator	it = d.begin();
+	d.erase(it + 1, d.end());
+	d.insert(d.begin(), 3, 42);
+	check("insert", d.size() == 4 && d.front() == 42 && d.back() == -1);
+}
+
+#if FT_CXX11
+int copy_counter::copies = 0;
+
+static void	move_semantics(void)
+{
+	print_header("Move semantics");
+	ft::vector<copy_counter> v1;
+	copy_counter c(7);
+
+	copy_counter::copies = 0;
+	for (int i = 0; i < 100; i++)
+		v1.push_back(copy_counter(i));
+	check("(growth) push_back(T&&) copies", copy_counter::copies, 0);
+	v1.emplace_back(100);
+	v1.emplace(v1.begin(), -2);
+	v1.insert(v1.begin() + 1, FT_MOVE(c));
+	check("(emplace/insert) copies", copy_counter::copies, 0);
+	check("v1.front() / v1[1] / v1.back()", v1.front().value == -2 && v1[1].value == 7 && v1.back().value == 100);
+	check("(moved from) c.value", c.value, -1);
+	check("v1.size()", v1.size(), (size_t)103);
+
+	ft::vector<copy_counter> v2(FT_MOVE(v1));
+	check("(move ctor) copies", copy_counter::copies, 0);
+	check("(move ctor) v2.size() / v1.empty()", v2.size() == 103 && v1.empty() && v1.capacity() == 0);
+	v1 = FT_MOVE(v2);
+	check("(move assign) v1.size() / v2.empty()", v1.size() == 103 && v2.empty());
+	check("(move assign) v1[50].value", v1[50].value, 48);
+
+	ft::vector<std::string> v3;
+	std::string s(100, 'x');
+	v3.push_back(FT_MOVE(s));
+	v3.emplace_back(3, 'y');
+	check("(string) v3[0].size() / s.empty()", v3[0].size() == 100 && s.empty());
+	check("(string) v3[1]", v3[1], std::string("yyy"));
+}
+#endif
+
 void	test_vector(void)
 {
 	print_header("Vector");
@@ -285,4 +1295,27 @@ void	test_vector(void)
 	erase();
 	swap();
 	operators();
+	relocation();
+	mmap_allocator();
+	growth_policy();
+	bulk_insert_erase();
+	small_vector();
+	static_vector();
+	resize_init();
+	huge_page_allocator();
+	segmented_vector();
+	search();
+	copy_assignment();
+	range_category();
+	shrink_to_fit();
+	bool_vector();
+	soa_vector();
+	exception_safety();
+	set_algorithms();
+	sort();
+	parallel_algorithms();
+	cow_vector();
+#if FT_CXX11
+	move_semantics();
+#endif
 }
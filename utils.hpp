@@ -1,5 +1,25 @@
 #ifndef UTILS_HPP
 # define UTILS_HPP
+# include <cstddef>
+# include <iterator>
+
+/**
+ * C++11 mode.
+ *
+ * The containers are written in C++98. Built with -std=c++11 or later, they also get move
+ * constructors and assignments, rvalue insertions and emplace functions, and they move
+ * their elements instead of copying them when they relocate them.
+ */
+# if __cplusplus >= 201103L
+#  define FT_CXX11 1
+#  include <utility>
+#  define FT_MOVE(x) std::move(x)
+#  define FT_MOVE_IF_NOEXCEPT(x) std::move_if_noexcept(x)
+# else
+#  define FT_CXX11 0
+#  define FT_MOVE(x) (x)
+#  define FT_MOVE_IF_NOEXCEPT(x) (x)
+# endif
 
 namespace	ft
 {
@@ -108,6 +128,253 @@ namespace	ft
     {
         static const bool value = false;
     };
+
+	/**
+	 * Iterator_category.
+	 *
+	 * The category tag of an iterator: its iterator_category typedef when it has one,
+	 * random access for pointers, and input otherwise, so that an unknown iterator is
+	 * only ever walked once.
+	 */
+	template<class It>
+	struct has_iterator_category
+	{
+		typedef char	yes;
+		typedef char	(&no)[2];
+
+		template<class U>
+		static yes	test(typename U::iterator_category *);
+		template<class U>
+		static no	test(...);
+
+		static const bool value = sizeof(test<It>(0)) == sizeof(yes);
+	};
+
+	template<class It, bool = has_iterator_category<It>::value>
+	struct iterator_category
+	{
+		typedef std::input_iterator_tag	type;
+	};
+
+	template<class It>
+	struct iterator_category<It, true>
+	{
+		typedef typename It::iterator_category	type;
+	};
+
+	template<class T>
+	struct iterator_category<T *, false>
+	{
+		typedef std::random_access_iterator_tag	type;
+	};
+
+	template<class T>
+	struct iterator_category<const T *, false>
+	{
+		typedef std::random_access_iterator_tag	type;
+	};
+
+	/**
+	 * IteratorValue.
+	 *
+	 * The value type of an iterator, pointers included.
+	 */
+	template<class It>
+	struct iteratorValue
+	{
+		typedef typename It::value_type	type;
+	};
+
+	template<class T>
+	struct iteratorValue<T *>
+	{
+		typedef T	type;
+	};
+
+	template<class T>
+	struct iteratorValue<const T *>
+	{
+		typedef T	type;
+	};
+
+	/**
+	 * Static_check.
+	 *
+	 * Compile-time assertion: sizeof(ft::static_check<Condition>) only compiles when Condition is true.
+	 */
+	template<bool Condition>
+	struct static_check;
+
+	template<>
+	struct static_check<true> {};
+
+	/**
+	 * Alignment_of.
+	 *
+	 * The alignment requirement of T: the offset at which a T follows a char in a struct.
+	 */
+	template<class T>
+	struct alignment_of
+	{
+		struct	padded
+		{
+			char	c;
+			T		t;
+		};
+
+		static const size_t value = sizeof(padded) - sizeof(T);
+	};
+
+	/**
+	 * Is_trivially_copyable.
+	 *
+	 * Checks whether T can be copied with memcpy. The compiler is asked when it can tell,
+	 * otherwise only arithmetic types and pointers are considered trivially copyable.
+	 */
+# if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+#  define FT_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+# else
+#  define FT_IS_TRIVIALLY_COPYABLE(T) false
+# endif
+
+	template<class Type>
+	struct is_trivially_copyable
+	{
+		static const bool value = FT_IS_TRIVIALLY_COPYABLE(Type) || is_integral<Type>::value;
+	};
+
+	template<class Type>
+	struct is_trivially_copyable<Type *>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_trivially_copyable<float>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_trivially_copyable<double>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_trivially_copyable<long double>
+	{
+		static const bool value = true;
+	};
+
+	/**
+	 * Is_trivially_default_constructible.
+	 *
+	 * Checks whether default-initializing a T does nothing, so that raw storage can be used
+	 * as is. The compiler is asked when it can tell, otherwise only arithmetic types and pointers are.
+	 */
+# if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+#  define FT_HAS_TRIVIAL_CONSTRUCTOR(T) __is_trivially_constructible(T)
+# elif defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+//older GCC only have the builtin that clang 15 deprecates
+#  define FT_HAS_TRIVIAL_CONSTRUCTOR(T) __has_trivial_constructor(T)
+# else
+#  define FT_HAS_TRIVIAL_CONSTRUCTOR(T) false
+# endif
+
+	template<class Type>
+	struct is_trivially_default_constructible
+	{
+		static const bool value = FT_HAS_TRIVIAL_CONSTRUCTOR(Type) || is_integral<Type>::value;
+	};
+
+	template<class Type>
+	struct is_trivially_default_constructible<Type *>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_trivially_default_constructible<float>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_trivially_default_constructible<double>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_trivially_default_constructible<long double>
+	{
+		static const bool value = true;
+	};
+
+	/**
+	 * Is_trivially_relocatable.
+	 *
+	 * Checks whether an object of type T can be moved to another address with memcpy,
+	 * the original being then forgotten without calling its destructor.
+	 *
+	 * Every trivially copyable type is. Specialize it for your own types whose objects
+	 * do not point into themselves, e.g. :
+	 *
+	 * template<> struct ft::is_trivially_relocatable<Record> { static const bool value = true; };
+	 */
+	template<class Type>
+	struct is_trivially_relocatable
+	{
+		static const bool value = is_trivially_copyable<Type>::value;
+	};
+
+	/**
+	 * Can_reallocate.
+	 *
+	 * Checks whether the allocator Alloc has a member
+	 * pointer reallocate(pointer p, size_type old_n, size_type new_n)
+	 * that resizes a block without copying it, returning NULL when it cannot.
+	 */
+	template<class Alloc>
+	struct can_reallocate
+	{
+		static const bool value = false;
+	};
+
+	/**
+	 * Max_align.
+	 *
+	 * A union of the fundamental types with the strictest alignments.
+	 */
+	union	max_align
+	{
+		long double		align_long_double;
+		long long		align_long_long;
+		void			*align_pointer;
+		void			(*align_function)(void);
+	};
+
+	/**
+	 * Aligned_buffer.
+	 *
+	 * Raw storage for N objects of type T, aligned for any fundamental type.
+	 * Nothing is constructed in it: the objects are placed there with the allocator's construct().
+	 *
+	 * Over-aligned types (e.g. __m256, or a struct declared with a larger alignment) cannot be
+	 * stored in it: this is checked at compile time.
+	 */
+	template<class T, size_t N>
+	union aligned_buffer
+	{
+		enum { checks = sizeof(ft::static_check<(ft::alignment_of<T>::value <= ft::alignment_of<max_align>::value)>) };
+
+		unsigned char	bytes[(N > 0 ? N : 1) * sizeof(T)];
+		max_align		align;
+
+		T		*data(void) { return (reinterpret_cast<T *>(bytes)); }
+		T const	*data(void) const { return (reinterpret_cast<T const *>(bytes)); }
+	};
 }
 
 #endif
@@ -0,0 +1,370 @@
+#ifndef COWVECTOR_HPP
+# define COWVECTOR_HPP
+# include "vector.hpp"
+
+namespace	ft
+{
+	/**
+	 * Copy-on-write vector: copies share one reference-counted ft::vector until one of them writes.
+	 *
+	 * Copying a cow_vector costs an atomic increment, so a large read-only buffer can be handed to
+	 * many consumers, in any thread, without being copied. The first modification of a shared
+	 * cow_vector copies the buffer (detaches), and the others keep the old one.
+	 *
+	 * Reading through a const cow_vector never copies. The non-const element accesses (operator[],
+	 * at, front, back, begin, end...) detach, since the reference or iterator they return may be
+	 * written through; the buffer is then kept unshared, later copies of this cow_vector copying
+	 * it right away, until clear(), assign() or operator= replaces its content. Read through
+	 * values(), or a const reference, to share.
+	 *
+	 * As for any container, an object must not be modified while another thread reads it; copies
+	 * sharing a buffer are distinct objects and can be used by different threads at once.
+	 */
+	template < class T, class Alloc = std::allocator<T>, class Growth = ft::grow_double >
+	class	cow_vector
+	{
+		public:
+			typedef	ft::vector<T, Alloc, Growth>					vector_type;
+			typedef	T												value_type;
+			typedef	Alloc											allocator_type;
+			typedef	typename vector_type::reference					reference;
+			typedef	typename vector_type::const_reference			const_reference;
+			typedef	typename vector_type::pointer					pointer;
+			typedef	typename vector_type::const_pointer				const_pointer;
+			typedef	typename vector_type::iterator					iterator;
+			typedef	typename vector_type::const_iterator			const_iterator;
+			typedef	typename vector_type::reverse_iterator			reverse_iterator;
+			typedef	typename vector_type::const_reverse_iterator	const_reverse_iterator;
+			typedef	typename vector_type::difference_type			difference_type;
+			typedef	typename vector_type::size_type					size_type;
+
+		private:
+			struct	cowBuffer
+			{
+				size_t			refs;
+				bool			leaked;
+				vector_type		values;
+
+				explicit cowBuffer (const vector_type &v): refs(1), leaked(false), values(v) {}
+			};
+
+			typedef	typename Alloc::template rebind<cowBuffer>::other	buffer_allocator;
+
+			//NULL while empty and never written
+			cowBuffer		*_c_buffer;
+			allocator_type	_c_allocator;
+
+			cowBuffer	*newBuffer (const vector_type &v)
+			{
+				buffer_allocator	alloc(this->_c_allocator);
+				cowBuffer			*buffer = alloc.allocate(1);
+
+				try
+				{
+					::new (static_cast<void *>(buffer)) cowBuffer(v);
+				}
+				catch (...)
+				{
+					alloc.deallocate(buffer, 1);
+					throw ;
+				}
+				return (buffer);
+			}
+
+			void	release (cowBuffer *buffer)
+			{
+				buffer_allocator	alloc(this->_c_allocator);
+
+				if (buffer != NULL && __sync_sub_and_fetch(&buffer->refs, 1) == 0)
+				{
+					buffer->~cowBuffer();
+					alloc.deallocate(buffer, 1);
+				}
+			}
+
+			/**
+			 * Share the buffer of x, or copy it if it is leaked.
+			 */
+			cowBuffer	*share (const cow_vector &x)
+			{
+				if (x._c_buffer == NULL)
+					return (NULL);
+				if (x._c_buffer->leaked)
+					return (newBuffer(x._c_buffer->values));
+				__sync_add_and_fetch(&x._c_buffer->refs, 1);
+				return (x._c_buffer);
+			}
+
+			/**
+			 * The values, owned by this cow_vector alone: the shared buffer is copied first.
+			 *
+			 * @leak : whether a reference to the values escapes, so that the buffer must not be shared anymore.
+			 */
+			vector_type	&detach (bool leak)
+			{
+				cowBuffer	*copy;
+
+				if (this->_c_buffer == NULL)
+					this->_c_buffer = newBuffer(vector_type(this->_c_allocator));
+				else if (__sync_add_and_fetch(&this->_c_buffer->refs, 0) > 1)
+				{
+					copy = newBuffer(this->_c_buffer->values);
+					release(this->_c_buffer);
+					this->_c_buffer = copy;
+				}
+				if (leak)
+					this->_c_buffer->leaked = true;
+				return (this->_c_buffer->values);
+			}
+
+			/**
+			 * Replace the content: the buffer is dropped instead of being copied when it is shared.
+			 */
+			vector_type	&replace (void)
+			{
+				if (this->_c_buffer != NULL && __sync_add_and_fetch(&this->_c_buffer->refs, 0) > 1)
+				{
+					release(this->_c_buffer);
+					this->_c_buffer = NULL;
+				}
+				if (this->_c_buffer == NULL)
+					this->_c_buffer = newBuffer(vector_type(this->_c_allocator));
+				this->_c_buffer->leaked = false;
+				return (this->_c_buffer->values);
+			}
+
+			static const vector_type	&emptyValues (void)
+			{
+				static const vector_type	empty;
+
+				return (empty);
+			}
+
+		public:
+			/**
+			 * Empty container constructor
+			 */
+			explicit	cow_vector (const allocator_type &alloc = allocator_type()): _c_buffer(NULL), _c_allocator(alloc) {}
+
+			/**
+			 * Fill constructor
+			 */
+			explicit	cow_vector (size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type()):
+				_c_buffer(NULL), _c_allocator(alloc)
+			{
+				if (n > 0)
+					this->_c_buffer = newBuffer(vector_type(n, val, alloc));
+			}
+
+			/**
+			 * Range constructor
+			 */
+			template <class InputIterator>
+			cow_vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last,
+				const allocator_type &alloc = allocator_type()): _c_buffer(NULL), _c_allocator(alloc)
+			{
+				if (first != last)
+					this->_c_buffer = newBuffer(vector_type(first, last, alloc));
+			}
+
+			/**
+			 * Snapshot of an ft::vector: its elements are copied once, then shared by the copies.
+			 */
+			cow_vector (const vector_type &v): _c_buffer(NULL), _c_allocator()
+			{
+				if (!v.empty())
+					this->_c_buffer = newBuffer(v);
+			}
+
+			/**
+			 * Copy constructor: shares the buffer of x, in O(1).
+			 */
+			cow_vector (const cow_vector &x): _c_buffer(NULL), _c_allocator(x._c_allocator)
+			{
+				this->_c_buffer = share(x);
+			}
+
+# if FT_CXX11
+			/**
+			 * Move constructor: takes the buffer of x, which is left empty.
+			 */
+			cow_vector (cow_vector&& x) noexcept: _c_buffer(x._c_buffer), _c_allocator(x._c_allocator)
+			{
+				x._c_buffer = NULL;
+			}
+
+			cow_vector	&operator= (cow_vector&& x) noexcept
+			{
+				if (this != &x)
+				{
+					release(this->_c_buffer);
+					this->_c_buffer = x._c_buffer;
+					x._c_buffer = NULL;
+				}
+				return (*this);
+			}
+# endif
+
+			~cow_vector (void)
+			{
+				release(this->_c_buffer);
+			}
+
+			/**
+			 * Assignation operator: shares the buffer of x, in O(1).
+			 */
+			cow_vector	&operator= (const cow_vector &x)
+			{
+				cowBuffer	*buffer;
+
+				if (this->_c_buffer == x._c_buffer)
+					return (*this);
+				buffer = share(x);
+				release(this->_c_buffer);
+				this->_c_buffer = buffer;
+				return (*this);
+			}
+
+		//SHARING METHODS
+
+			/**
+			 * The values, read-only and without copying them.
+			 */
+			const vector_type	&values (void) const
+			{
+				return (this->_c_buffer != NULL ? this->_c_buffer->values : emptyValues());
+			}
+
+			/**
+			 * Number of cow_vector sharing the values of this one (1 when it owns them alone).
+			 */
+			size_type	use_count (void) const
+			{
+				return (this->_c_buffer != NULL ? __sync_add_and_fetch(&this->_c_buffer->refs, 0) : 1);
+			}
+
+			bool	unique (void) const { return (use_count() == 1); }
+
+			allocator_type	get_allocator (void) const { return (this->_c_allocator); }
+
+		//ITERATORS METHODS
+
+			iterator				begin (void) { return (detach(true).begin()); }
+			const_iterator			begin (void) const { return (values().begin()); }
+			iterator				end (void) { return (detach(true).end()); }
+			const_iterator			end (void) const { return (values().end()); }
+			reverse_iterator		rbegin (void) { return (detach(true).rbegin()); }
+			const_reverse_iterator	rbegin (void) const { return (values().rbegin()); }
+			reverse_iterator		rend (void) { return (detach(true).rend()); }
+			const_reverse_iterator	rend (void) const { return (values().rend()); }
+
+		//CAPACITY METHODS
+
+			size_type	size (void) const { return (values().size()); }
+			size_type	max_size (void) const { return (values().max_size()); }
+			size_type	capacity (void) const { return (values().capacity()); }
+			bool		empty (void) const { return (values().empty()); }
+
+			void	resize (size_type n, value_type val = value_type()) { detach(false).resize(n, val); }
+			void	reserve (size_type n) { detach(false).reserve(n); }
+
+		//ELEMENT ACCESS METHODS
+
+			reference		operator[] (size_type n) { return (detach(true)[n]); }
+			const_reference	operator[] (size_type n) const { return (values()[n]); }
+			reference		at (size_type n) { return (detach(true).at(n)); }
+			const_reference	at (size_type n) const { return (values().at(n)); }
+			reference		front (void) { return (detach(true).front()); }
+			const_reference	front (void) const { return (values().front()); }
+			reference		back (void) { return (detach(true).back()); }
+			const_reference	back (void) const { return (values().back()); }
+
+		//MODIFIERS METHODS
+
+			template <class InputIterator>
+			void	assign (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+			{
+				replace().assign(first, last);
+			}
+
+			void	assign (size_type n, const value_type &val) { replace().assign(n, val); }
+			void	push_back (const value_type &val) { detach(false).push_back(val); }
+			void	pop_back (void) { detach(false).pop_back(); }
+
+			/**
+			 * The position iterators come from the non-const begin() or end(), which already detached.
+			 */
+			iterator	insert (iterator position, const value_type &val) { return (detach(false).insert(position, val)); }
+			void		insert (iterator position, size_type n, const value_type &val) { detach(false).insert(position, n, val); }
+
+			template <class InputIterator>
+			void	insert (iterator position, InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+			{
+				detach(false).insert(position, first, last);
+			}
+
+			iterator	erase (iterator position) { return (detach(false).erase(position)); }
+			iterator	erase (iterator first, iterator last) { return (detach(false).erase(first, last)); }
+
+			void	swap (cow_vector &x)
+			{
+				cowBuffer	*tmp = x._c_buffer;
+
+				x._c_buffer = this->_c_buffer;
+				this->_c_buffer = tmp;
+			}
+
+			/**
+			 * Remove all the elements; a shared buffer is left to the other copies.
+			 */
+			void	clear (void)
+			{
+				release(this->_c_buffer);
+				this->_c_buffer = NULL;
+			}
+	};
+
+	template < class T, class Alloc, class Growth >
+	bool	operator== (const cow_vector<T, Alloc, Growth> &lhs, const cow_vector<T, Alloc, Growth> &rhs)
+	{
+		return (lhs.values() == rhs.values());
+	}
+
+	template < class T, class Alloc, class Growth >
+	bool	operator!= (const cow_vector<T, Alloc, Growth> &lhs, const cow_vector<T, Alloc, Growth> &rhs)
+	{
+		return (lhs.values() != rhs.values());
+	}
+
+	template < class T, class Alloc, class Growth >
+	bool	operator< (const cow_vector<T, Alloc, Growth> &lhs, const cow_vector<T, Alloc, Growth> &rhs)
+	{
+		return (lhs.values() < rhs.values());
+	}
+
+	template < class T, class Alloc, class Growth >
+	bool	operator<= (const cow_vector<T, Alloc, Growth> &lhs, const cow_vector<T, Alloc, Growth> &rhs)
+	{
+		return (lhs.values() <= rhs.values());
+	}
+
+	template < class T, class Alloc, class Growth >
+	bool	operator> (const cow_vector<T, Alloc, Growth> &lhs, const cow_vector<T, Alloc, Growth> &rhs)
+	{
+		return (lhs.values() > rhs.values());
+	}
+
+	template < class T, class Alloc, class Growth >
+	bool	operator>= (const cow_vector<T, Alloc, Growth> &lhs, const cow_vector<T, Alloc, Growth> &rhs)
+	{
+		return (lhs.values() >= rhs.values());
+	}
+
+	template < class T, class Alloc, class Growth >
+	void	swap (cow_vector<T, Alloc, Growth> &x, cow_vector<T, Alloc, Growth> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef GROWTHPOLICY_HPP
+# define GROWTHPOLICY_HPP
+# include <cstddef>
+
+/**
+ * Growth policies of ft::vector.
+ *
+ * A policy is a class with a static member
+ * size_t grow(size_t capacity, size_t required, size_t element_size)
+ * returning the new capacity of a vector holding capacity elements of element_size bytes
+ * that needs room for at least required elements. The result must be at least required.
+ */
+namespace	ft
+{
+	/**
+	 * Doubles the capacity. Few reallocations, up to half of the buffer may be unused.
+	 */
+	struct	grow_double
+	{
+		static size_t	grow(size_t capacity, size_t required, size_t)
+		{
+			size_t	next = capacity > 0 ? capacity * 2 : 1;
+
+			return (required > next ? required : next);
+		}
+	};
+
+	/**
+	 * Grows the capacity by half. More reallocations than grow_double, but a third of the
+	 * buffer at most is unused, and the sum of the blocks freed so far eventually exceeds
+	 * the next request, so the allocator can reuse them.
+	 */
+	struct	grow_half
+	{
+		static size_t	grow(size_t capacity, size_t required, size_t)
+		{
+			size_t	next = capacity + capacity / 2 + 1;
+
+			return (required > next ? required : next);
+		}
+	};
+
+	/**
+	 * Grows the capacity by fixed chunks of Chunk elements. Memory usage is tight but
+	 * filling a vector of n elements costs O(n * n / Chunk) copies.
+	 */
+	template <size_t Chunk>
+	struct	grow_chunk
+	{
+		static size_t	grow(size_t, size_t required, size_t)
+		{
+			return ((required + Chunk - 1) / Chunk * Chunk);
+		}
+	};
+
+	/**
+	 * Doubles the capacity, then rounds it up to the size of the block malloc really hands out,
+	 * so that the slack of the block is used for elements instead of being wasted.
+	 *
+	 * The size classes are those of glibc: chunks are multiples of 16 bytes with an 8 bytes header,
+	 * and blocks above the mmap threshold are whole pages minus a 16 bytes header.
+	 */
+	struct	grow_size_class
+	{
+		static size_t	grow(size_t capacity, size_t required, size_t element_size)
+		{
+			size_t	count = grow_double::grow(capacity, required, element_size);
+			size_t	bytes = count * element_size;
+
+			if (bytes < 128 * 1024)
+				bytes = ((bytes + 8 + 15) & ~static_cast<size_t>(15)) - 8;
+			else
+				bytes = ((bytes + 16 + 4095) & ~static_cast<size_t>(4095)) - 16;
+			return (bytes / element_size > count ? bytes / element_size : count);
+		}
+	};
+}
+
+#endif
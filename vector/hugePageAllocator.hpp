@@ -0,0 +1,214 @@
+#ifndef HUGEPAGEALLOCATOR_HPP
+# define HUGEPAGEALLOCATOR_HPP
+# include <cstddef>
+# include <limits>
+# include <new>
+# include <unistd.h>
+# include <sys/mman.h>
+# ifdef __linux__
+#  include <sys/syscall.h>
+# endif
+# include "../utils.hpp"
+
+namespace	ft
+{
+	/**
+	 * NUMA placement of the pages of a huge_page_allocator.
+	 *
+	 * numa_default : pages go wherever the kernel policy of the thread puts them (usually the node first touching them).
+	 * numa_bind : pages are only taken from the nodes of the mask.
+	 * numa_interleave : pages are spread round-robin over the nodes of the mask.
+	 */
+	enum	numa_policy
+	{
+		numa_default,
+		numa_bind,
+		numa_interleave
+	};
+
+	/**
+	 * Allocator backing large blocks with huge pages.
+	 *
+	 * Blocks of at least MMAP_THRESHOLD bytes are mapped on their own, aligned and rounded up
+	 * to HUGE_PAGE_SIZE, and the kernel is asked to back them with transparent huge pages
+	 * (madvise(MADV_HUGEPAGE)), or with pages of the hugetlbfs pool (MAP_HUGETLB) if requested.
+	 * The pages can also be bound to, or interleaved across, a set of NUMA nodes with mbind.
+	 * Smaller blocks come from operator new.
+	 *
+	 * Every request is a hint: without huge pages, hugetlbfs pool or NUMA support (or on other
+	 * systems than Linux), the block is simply made of normal pages.
+	 */
+	template <class T>
+	class	huge_page_allocator
+	{
+		public:
+			typedef	T					value_type;
+			typedef	T					*pointer;
+			typedef	T const				*const_pointer;
+			typedef	T					&reference;
+			typedef	T const				&const_reference;
+			typedef	size_t				size_type;
+			typedef	std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct	rebind { typedef huge_page_allocator<U> other; };
+
+			static const size_type	MMAP_THRESHOLD = 1 << 20;
+			static const size_type	HUGE_PAGE_SIZE = 1 << 21;
+
+		private:
+			numa_policy		_a_policy;
+			unsigned long	_a_nodemask;
+			bool			_a_hugetlb;
+
+			template <class U>
+			friend class	huge_page_allocator;
+
+			/**
+			 * Returns the number of bytes mapped for n elements, 0 if they are not mapped.
+			 *
+			 * It only depends on n, so any allocator can release a block of another one.
+			 */
+			static size_type	mappedSize (size_type n)
+			{
+				size_type	bytes = n * sizeof(T);
+
+				if (bytes < MMAP_THRESHOLD)
+					return (0);
+				return ((bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE);
+			}
+
+			/**
+			 * Maps length bytes at an address aligned on HUGE_PAGE_SIZE, so that the
+			 * kernel can use huge pages for the whole block.
+			 */
+			static void	*mapAligned (size_type length)
+			{
+				char		*p;
+				size_type	head;
+
+				p = static_cast<char *>(mmap(NULL, length + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+				if (p == MAP_FAILED)
+					return (MAP_FAILED);
+				head = (HUGE_PAGE_SIZE - reinterpret_cast<size_t>(p) % HUGE_PAGE_SIZE) % HUGE_PAGE_SIZE;
+				if (head > 0)
+					munmap(p, head);
+				munmap(p + head + length, HUGE_PAGE_SIZE - head);
+				return (p + head);
+			}
+
+			/**
+			 * Applies the NUMA policy to the block. Failures are ignored: the pages are then placed by default.
+			 */
+			void	placePages (void *p, size_type length) const
+			{
+# if defined(__linux__) && defined(SYS_mbind)
+				//values of MPOL_BIND and MPOL_INTERLEAVE in <linux/mempolicy.h>
+				int				mode = this->_a_policy == numa_bind ? 2 : 3;
+				unsigned long	mask = this->_a_nodemask;
+
+				if (this->_a_policy != numa_default)
+					syscall(SYS_mbind, p, length, mode, &mask, sizeof(mask) * 8, 0);
+# else
+				(void)p;
+				(void)length;
+# endif
+			}
+
+		public:
+			/**
+			 * Constructor.
+			 *
+			 * @policy : the NUMA placement of the pages.
+			 * @nodemask : the NUMA nodes used by numa_bind and numa_interleave, bit i standing for node i.
+			 * @hugetlb : map the blocks with MAP_HUGETLB, which needs huge pages reserved in the system pool.
+			 */
+			explicit huge_page_allocator (numa_policy policy = numa_default, unsigned long nodemask = ~0UL, bool hugetlb = false):
+				_a_policy(policy), _a_nodemask(nodemask), _a_hugetlb(hugetlb) {}
+			huge_page_allocator (const huge_page_allocator &x):
+				_a_policy(x._a_policy), _a_nodemask(x._a_nodemask), _a_hugetlb(x._a_hugetlb) {}
+			template <class U>
+			huge_page_allocator (const huge_page_allocator<U> &x):
+				_a_policy(x._a_policy), _a_nodemask(x._a_nodemask), _a_hugetlb(x._a_hugetlb) {}
+			~huge_page_allocator (void) {}
+
+			pointer			address (reference x) const { return (&x); }
+			const_pointer	address (const_reference x) const { return (&x); }
+
+			numa_policy		policy (void) const { return (this->_a_policy); }
+			unsigned long	nodemask (void) const { return (this->_a_nodemask); }
+			bool			hugetlb (void) const { return (this->_a_hugetlb); }
+
+			/**
+			 * Allocate storage for n elements.
+			 *
+			 * @n : the number of elements.
+			 * @return : a pointer to the uninitialized storage.
+			 */
+			pointer	allocate (size_type n, const void * = 0)
+			{
+				size_type	length = mappedSize(n);
+				void		*p = MAP_FAILED;
+
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (length == 0)
+					return (static_cast<pointer>(::operator new(n * sizeof(T))));
+# ifdef MAP_HUGETLB
+				if (this->_a_hugetlb)
+					p = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+# endif
+				if (p == MAP_FAILED)
+				{
+					p = mapAligned(length);
+					if (p == MAP_FAILED)
+						throw std::bad_alloc();
+# ifdef MADV_HUGEPAGE
+					madvise(p, length, MADV_HUGEPAGE);
+# endif
+				}
+				placePages(p, length);
+				return (static_cast<pointer>(p));
+			}
+
+			/**
+			 * Release storage obtained from allocate().
+			 *
+			 * @p : the storage.
+			 * @n : the number of elements it was allocated for.
+			 */
+			void	deallocate (pointer p, size_type n)
+			{
+				size_type	length = mappedSize(n);
+
+				if (length == 0)
+					::operator delete(p);
+				else
+					munmap(p, length);
+			}
+
+			size_type	max_size (void) const
+			{
+				return (std::numeric_limits<size_type>::max() / sizeof(T));
+			}
+
+# if FT_CXX11
+			template <class U, class... Args>
+			void	construct (U *p, Args&&... args) { ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+# else
+			void	construct (pointer p, const_reference val) { ::new (static_cast<void *>(p)) T(val); }
+# endif
+			void	destroy (pointer p) { p->~T(); }
+	};
+
+	/**
+	 * Any huge_page_allocator can release the blocks of another one, whatever their placement.
+	 */
+	template <class T, class U>
+	bool	operator== (const huge_page_allocator<T> &, const huge_page_allocator<U> &) { return (true); }
+
+	template <class T, class U>
+	bool	operator!= (const huge_page_allocator<T> &, const huge_page_allocator<U> &) { return (false); }
+}
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef MMAPALLOCATOR_HPP
+# define MMAPALLOCATOR_HPP
+# include <cstddef>
+# include <limits>
+# include <new>
+# include <unistd.h>
+# include <sys/mman.h>
+# include "../utils.hpp"
+
+namespace	ft
+{
+	/**
+	 * Allocator backing large blocks with anonymous memory mappings.
+	 *
+	 * Blocks of at least MMAP_THRESHOLD bytes are mapped with mmap and, on Linux,
+	 * can be grown with reallocate(), which asks the kernel to move the pages with
+	 * mremap instead of copying the bytes. Smaller blocks come from operator new.
+	 *
+	 * ft::vector uses reallocate() when it grows a buffer of trivially relocatable elements.
+	 */
+	template <class T>
+	class	mmap_allocator
+	{
+		public:
+			typedef	T					value_type;
+			typedef	T					*pointer;
+			typedef	T const				*const_pointer;
+			typedef	T					&reference;
+			typedef	T const				&const_reference;
+			typedef	size_t				size_type;
+			typedef	std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct	rebind { typedef mmap_allocator<U> other; };
+
+			static const size_type	MMAP_THRESHOLD = 1 << 20;
+
+		private:
+			/**
+			 * Returns the number of bytes mapped for n elements, 0 if they are not mapped.
+			 */
+			static size_type	mappedSize (size_type n)
+			{
+				size_type	bytes = n * sizeof(T);
+				size_type	page = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+
+				if (bytes < MMAP_THRESHOLD)
+					return (0);
+				return ((bytes + page - 1) / page * page);
+			}
+
+		public:
+			mmap_allocator (void) {}
+			mmap_allocator (const mmap_allocator &) {}
+			template <class U>
+			mmap_allocator (const mmap_allocator<U> &) {}
+			~mmap_allocator (void) {}
+
+			pointer			address (reference x) const { return (&x); }
+			const_pointer	address (const_reference x) const { return (&x); }
+
+			/**
+			 * Allocate storage for n elements.
+			 *
+			 * @n : the number of elements.
+			 * @return : a pointer to the uninitialized storage.
+			 */
+			pointer	allocate (size_type n, const void * = 0)
+			{
+				size_type	length = mappedSize(n);
+				void		*p;
+
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (length == 0)
+					return (static_cast<pointer>(::operator new(n * sizeof(T))));
+				p = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (p == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(p));
+			}
+
+			/**
+			 * Release storage obtained from allocate() or reallocate().
+			 *
+			 * @p : the storage.
+			 * @n : the number of elements it was allocated for.
+			 */
+			void	deallocate (pointer p, size_type n)
+			{
+				size_type	length = mappedSize(n);
+
+				if (length == 0)
+					::operator delete(p);
+				else
+					munmap(p, length);
+			}
+
+			/**
+			 * Grow or shrink storage in place, or move its pages elsewhere, without copying.
+			 *
+			 * Only possible when both the old and the new sizes are mapped, on systems with mremap.
+			 * The content is kept bytewise, so it is only valid for trivially relocatable elements.
+			 *
+			 * @p : the storage.
+			 * @old_n / @new_n : the number of elements it holds now and will hold.
+			 * @return : the new storage, or NULL if it could not be done, p being then left untouched.
+			 */
+			pointer	reallocate (pointer p, size_type old_n, size_type new_n)
+			{
+# ifdef MREMAP_MAYMOVE
+				size_type	old_length = mappedSize(old_n);
+				size_type	new_length = mappedSize(new_n);
+				void		*q;
+
+				if (old_length == 0 || new_length == 0 || new_n > max_size())
+					return (NULL);
+				if (old_length == new_length)
+					return (p);
+				q = mremap(p, old_length, new_length, MREMAP_MAYMOVE);
+				if (q == MAP_FAILED)
+					return (NULL);
+				return (static_cast<pointer>(q));
+# else
+				(void)p;
+				(void)old_n;
+				(void)new_n;
+				return (NULL);
+# endif
+			}
+
+			size_type	max_size (void) const
+			{
+				return (std::numeric_limits<size_type>::max() / sizeof(T));
+			}
+
+# if FT_CXX11
+			template <class U, class... Args>
+			void	construct (U *p, Args&&... args) { ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+# else
+			void	construct (pointer p, const_reference val) { ::new (static_cast<void *>(p)) T(val); }
+# endif
+			void	destroy (pointer p) { p->~T(); }
+	};
+
+	template <class T, class U>
+	bool	operator== (const mmap_allocator<T> &, const mmap_allocator<U> &) { return (true); }
+
+	template <class T, class U>
+	bool	operator!= (const mmap_allocator<T> &, const mmap_allocator<U> &) { return (false); }
+
+	template <class T>
+	struct	can_reallocate<mmap_allocator<T> >
+	{
+		static const bool value = true;
+	};
+}
+
+#endif
@@ -0,0 +1,904 @@
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+# include <cstddef>
+# include <algorithm>
+# include <memory>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+# include "sort.hpp"
+# include "setAlgorithms.hpp"
+
+/**
+ * Algorithms run by several threads: for_each, transform, reduce, fill, copy, sort and stable_sort.
+ *
+ * A range is split into pieces that the threads of a thread_pool take from one another (work
+ * stealing): each thread works through its piece a grain at a time, and only cuts the rest of it
+ * in two when its own queue is empty, so pieces are split as often as some thread runs out of
+ * work, not more. Ranges below PARALLEL_THRESHOLD elements, and calls made while the pool is busy
+ * (from another thread, or from inside a parallel call), run sequentially in the calling thread.
+ *
+ * The functions given to the algorithms run in several threads at once, so they must be safe to
+ * call concurrently and must not throw.
+ */
+namespace	ft
+{
+	namespace	parallel
+	{
+		//below this number of elements, the algorithms do not start the pool
+		static const size_t	PARALLEL_THRESHOLD = 1 << 15;
+
+		//smallest piece of a range given to a thread at once
+		static const size_t	MIN_GRAIN = 2048;
+
+		/**
+		 * Work shared by the threads of a thread_pool: the indexes [0, size) processed by pieces.
+		 */
+		class	parallelTask
+		{
+			public:
+				virtual			~parallelTask (void) {}
+
+				/**
+				 * Process the indexes [begin, end), in the thread number worker of the pool.
+				 */
+				virtual void	execute (size_t worker, size_t begin, size_t end) = 0;
+		};
+
+		/**
+		 * Fixed set of threads running one parallelTask at a time.
+		 *
+		 * The thread calling run() takes part in the work, as worker 0, so a pool of n threads
+		 * starts n - 1 of them. Every worker owns a queue of pieces: it takes from the back of
+		 * its own, and steals from the front of the others when it is empty.
+		 */
+		class	thread_pool
+		{
+			private:
+				struct	piece
+				{
+					size_t	begin;
+					size_t	end;
+				};
+
+				//capacity of a queue; a full queue stops splitting, it never overflows
+				static const size_t	QUEUE_SIZE = 64;
+
+				struct	queue
+				{
+					pthread_mutex_t	lock;
+					piece			items[QUEUE_SIZE];
+					size_t			head;
+					size_t			count;
+				};
+
+				struct	worker
+				{
+					thread_pool		*pool;
+					size_t			id;
+					pthread_t		thread;
+					bool			started;
+				};
+
+				size_t			_p_threads;
+				queue			*_p_queues;
+				worker			*_p_workers;
+				pthread_mutex_t	_p_run;
+				pthread_mutex_t	_p_lock;
+				pthread_cond_t	_p_wake;
+				pthread_cond_t	_p_done;
+				parallelTask	*_p_task;
+				size_t			_p_grain;
+				size_t			_p_generation;
+				size_t			_p_active;
+				size_t			_p_pending;
+				bool			_p_stop;
+
+				thread_pool (const thread_pool &);
+				thread_pool &operator= (const thread_pool &);
+
+				bool	push (size_t id, size_t begin, size_t end)
+				{
+					queue	&q = this->_p_queues[id];
+					bool	pushed = false;
+
+					pthread_mutex_lock(&q.lock);
+					if (q.count < QUEUE_SIZE)
+					{
+						q.items[(q.head + q.count) % QUEUE_SIZE].begin = begin;
+						q.items[(q.head + q.count) % QUEUE_SIZE].end = end;
+						q.count++;
+						pushed = true;
+					}
+					pthread_mutex_unlock(&q.lock);
+					return (pushed);
+				}
+
+				/**
+				 * Take a piece from the back (owner) or the front (thief) of queue id.
+				 */
+				bool	take (size_t id, bool front, piece &p)
+				{
+					queue	&q = this->_p_queues[id];
+					bool	taken = false;
+
+					pthread_mutex_lock(&q.lock);
+					if (q.count > 0)
+					{
+						if (front)
+						{
+							p = q.items[q.head];
+							q.head = (q.head + 1) % QUEUE_SIZE;
+						}
+						else
+							p = q.items[(q.head + q.count - 1) % QUEUE_SIZE];
+						q.count--;
+						taken = true;
+					}
+					pthread_mutex_unlock(&q.lock);
+					return (taken);
+				}
+
+				bool	isEmpty (size_t id)
+				{
+					queue	&q = this->_p_queues[id];
+					bool	empty;
+
+					pthread_mutex_lock(&q.lock);
+					empty = (q.count == 0);
+					pthread_mutex_unlock(&q.lock);
+					return (empty);
+				}
+
+				/**
+				 * Work until every index of the task is processed.
+				 *
+				 * A piece is processed a grain at a time; between two grains, if the queue of
+				 * the worker was emptied by a thief, the rest of the piece is cut in two and its
+				 * second half is pushed there, to be stolen in turn.
+				 */
+				void	work (size_t id)
+				{
+					piece	p;
+					size_t	half;
+					size_t	end;
+
+					while (__sync_add_and_fetch(&this->_p_pending, 0) > 0)
+					{
+						bool	found = take(id, false, p);
+
+						for (size_t i = 1; !found && i < this->_p_threads; ++i)
+							found = take((id + i) % this->_p_threads, true, p);
+						if (!found)
+						{
+							sched_yield();
+							continue ;
+						}
+						while (p.begin < p.end)
+						{
+							if (p.end - p.begin >= 2 * this->_p_grain && isEmpty(id))
+							{
+								half = p.begin + (p.end - p.begin) / 2;
+								if (push(id, half, p.end))
+									p.end = half;
+							}
+							end = p.end - p.begin > this->_p_grain ? p.begin + this->_p_grain : p.end;
+							this->_p_task->execute(id, p.begin, end);
+							__sync_sub_and_fetch(&this->_p_pending, end - p.begin);
+							p.begin = end;
+						}
+					}
+				}
+
+				static void	*routine (void *arg)
+				{
+					worker			*w = static_cast<worker *>(arg);
+					thread_pool		*pool = w->pool;
+					size_t			seen = 0;
+
+					pthread_mutex_lock(&pool->_p_lock);
+					for (;;)
+					{
+						while (!pool->_p_stop && (pool->_p_task == NULL || pool->_p_generation == seen))
+							pthread_cond_wait(&pool->_p_wake, &pool->_p_lock);
+						if (pool->_p_stop)
+							break ;
+						seen = pool->_p_generation;
+						pool->_p_active++;
+						pthread_mutex_unlock(&pool->_p_lock);
+						pool->work(w->id);
+						pthread_mutex_lock(&pool->_p_lock);
+						if (--pool->_p_active == 0)
+							pthread_cond_broadcast(&pool->_p_done);
+					}
+					pthread_mutex_unlock(&pool->_p_lock);
+					return (NULL);
+				}
+
+			public:
+				/**
+				 * Start a pool.
+				 *
+				 * @threads : the number of threads working on a task, the caller of run() included.
+				 * 0 stands for the number of processors online.
+				 */
+				explicit	thread_pool (size_t threads = 0): _p_task(NULL), _p_grain(1), _p_generation(0),
+					_p_active(0), _p_pending(0), _p_stop(false)
+				{
+					long	online;
+
+					if (threads == 0)
+					{
+						online = sysconf(_SC_NPROCESSORS_ONLN);
+						threads = online > 0 ? static_cast<size_t>(online) : 1;
+					}
+					this->_p_threads = threads;
+					pthread_mutex_init(&this->_p_run, NULL);
+					pthread_mutex_init(&this->_p_lock, NULL);
+					pthread_cond_init(&this->_p_wake, NULL);
+					pthread_cond_init(&this->_p_done, NULL);
+					this->_p_queues = std::allocator<queue>().allocate(threads);
+					this->_p_workers = std::allocator<worker>().allocate(threads);
+					for (size_t i = 0; i < threads; ++i)
+					{
+						pthread_mutex_init(&this->_p_queues[i].lock, NULL);
+						this->_p_queues[i].head = 0;
+						this->_p_queues[i].count = 0;
+						this->_p_workers[i].pool = this;
+						this->_p_workers[i].id = i;
+						//worker 0 is the caller of run()
+						this->_p_workers[i].started = (i > 0 && pthread_create(&this->_p_workers[i].thread, NULL, &routine, &this->_p_workers[i]) == 0);
+					}
+				}
+
+				~thread_pool (void)
+				{
+					pthread_mutex_lock(&this->_p_lock);
+					this->_p_stop = true;
+					pthread_cond_broadcast(&this->_p_wake);
+					pthread_mutex_unlock(&this->_p_lock);
+					for (size_t i = 0; i < this->_p_threads; ++i)
+					{
+						if (this->_p_workers[i].started)
+							pthread_join(this->_p_workers[i].thread, NULL);
+						pthread_mutex_destroy(&this->_p_queues[i].lock);
+					}
+					std::allocator<worker>().deallocate(this->_p_workers, this->_p_threads);
+					std::allocator<queue>().deallocate(this->_p_queues, this->_p_threads);
+					pthread_cond_destroy(&this->_p_done);
+					pthread_cond_destroy(&this->_p_wake);
+					pthread_mutex_destroy(&this->_p_lock);
+					pthread_mutex_destroy(&this->_p_run);
+				}
+
+				/**
+				 * Number of threads working on a task, the caller of run() included.
+				 */
+				size_t	size (void) const { return (this->_p_threads); }
+
+				/**
+				 * Process the indexes [0, n) of task, and return once they all are.
+				 *
+				 * If the pool is already running a task, or n is not larger than grain,
+				 * the calling thread processes [0, n) alone, as worker 0.
+				 *
+				 * @task : the work to do.
+				 * @n : the number of indexes.
+				 * @grain : the number of indexes processed by a thread at once.
+				 */
+				void	run (parallelTask &task, size_t n, size_t grain)
+				{
+					if (grain == 0)
+						grain = 1;
+					if (n <= grain || this->_p_threads < 2 || pthread_mutex_trylock(&this->_p_run) != 0)
+					{
+						if (n > 0)
+							task.execute(0, 0, n);
+						return ;
+					}
+					this->_p_grain = grain;
+					this->_p_pending = n;
+					push(0, 0, n);
+					pthread_mutex_lock(&this->_p_lock);
+					this->_p_task = &task;
+					this->_p_generation++;
+					pthread_cond_broadcast(&this->_p_wake);
+					pthread_mutex_unlock(&this->_p_lock);
+					work(0);
+					//the task lives on the stack of the caller: wait for every worker to leave it
+					pthread_mutex_lock(&this->_p_lock);
+					this->_p_task = NULL;
+					while (this->_p_active > 0)
+						pthread_cond_wait(&this->_p_done, &this->_p_lock);
+					pthread_mutex_unlock(&this->_p_lock);
+					pthread_mutex_unlock(&this->_p_run);
+				}
+		};
+
+		/**
+		 * The pool used by the algorithms, one thread per processor online, started at the first call.
+		 */
+		inline thread_pool	&default_pool (void)
+		{
+			static thread_pool	instance;
+
+			return (instance);
+		}
+
+		/**
+		 * Grain of a range of n elements: about 16 grains per thread, and at least MIN_GRAIN elements.
+		 */
+		inline size_t	grainSize (size_t n, size_t threads)
+		{
+			size_t	grain = n / (threads * 16);
+
+			return (grain < MIN_GRAIN ? MIN_GRAIN : grain);
+		}
+
+		template <class RandomIterator, class Function>
+		class	forEachTask: public parallelTask
+		{
+			private:
+				RandomIterator	_t_first;
+				Function		_t_f;
+
+			public:
+				forEachTask (RandomIterator first, Function f): _t_first(first), _t_f(f) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					std::for_each(this->_t_first + begin, this->_t_first + end, this->_t_f);
+				}
+		};
+
+		template <class RandomIterator, class OutputIterator, class UnaryOperation>
+		class	transformTask: public parallelTask
+		{
+			private:
+				RandomIterator	_t_first;
+				OutputIterator	_t_result;
+				UnaryOperation	_t_op;
+
+			public:
+				transformTask (RandomIterator first, OutputIterator result, UnaryOperation op): _t_first(first), _t_result(result), _t_op(op) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					std::transform(this->_t_first + begin, this->_t_first + end, this->_t_result + begin, this->_t_op);
+				}
+		};
+
+		template <class RandomIterator1, class RandomIterator2, class OutputIterator, class BinaryOperation>
+		class	transform2Task: public parallelTask
+		{
+			private:
+				RandomIterator1	_t_first1;
+				RandomIterator2	_t_first2;
+				OutputIterator	_t_result;
+				BinaryOperation	_t_op;
+
+			public:
+				transform2Task (RandomIterator1 first1, RandomIterator2 first2, OutputIterator result, BinaryOperation op):
+					_t_first1(first1), _t_first2(first2), _t_result(result), _t_op(op) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					std::transform(this->_t_first1 + begin, this->_t_first1 + end, this->_t_first2 + begin, this->_t_result + begin, this->_t_op);
+				}
+		};
+
+		template <class RandomIterator, class T>
+		class	fillTask: public parallelTask
+		{
+			private:
+				RandomIterator	_t_first;
+				const T			&_t_val;
+
+			public:
+				fillTask (RandomIterator first, const T &val): _t_first(first), _t_val(val) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					std::fill(this->_t_first + begin, this->_t_first + end, this->_t_val);
+				}
+		};
+
+		template <class RandomIterator, class OutputIterator>
+		class	copyTask: public parallelTask
+		{
+			private:
+				RandomIterator	_t_first;
+				OutputIterator	_t_result;
+
+			public:
+				copyTask (RandomIterator first, OutputIterator result): _t_first(first), _t_result(result) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					std::copy(this->_t_first + begin, this->_t_first + end, this->_t_result + begin);
+				}
+		};
+
+		/**
+		 * Every worker folds the pieces it processes into its own partial result;
+		 * the partial results are folded together at the end.
+		 */
+		template <class RandomIterator, class T, class BinaryOperation>
+		class	reduceTask: public parallelTask
+		{
+			private:
+				struct	partial
+				{
+					T		value;
+					bool	used;
+					//keeps two partial results out of the same cache line
+					char	pad[64];
+				};
+
+				RandomIterator	_t_first;
+				BinaryOperation	_t_op;
+				partial			*_t_partials;
+				size_t			_t_count;
+
+				reduceTask (const reduceTask &);
+				reduceTask &operator= (const reduceTask &);
+
+			public:
+				reduceTask (RandomIterator first, BinaryOperation op, size_t workers): _t_first(first), _t_op(op), _t_count(workers)
+				{
+					this->_t_partials = std::allocator<partial>().allocate(workers);
+					for (size_t i = 0; i < workers; ++i)
+						this->_t_partials[i].used = false;
+				}
+
+				~reduceTask (void)
+				{
+					for (size_t i = 0; i < this->_t_count; ++i)
+					{
+						if (this->_t_partials[i].used)
+							this->_t_partials[i].value.~T();
+					}
+					std::allocator<partial>().deallocate(this->_t_partials, this->_t_count);
+				}
+
+				void	execute (size_t worker, size_t begin, size_t end)
+				{
+					partial			&p = this->_t_partials[worker];
+					RandomIterator	it = this->_t_first + begin;
+
+					if (!p.used)
+					{
+						::new (static_cast<void *>(&p.value)) T(*it++);
+						p.used = true;
+					}
+					for (; it != this->_t_first + end; ++it)
+						p.value = this->_t_op(p.value, *it);
+				}
+
+				T	result (T init)
+				{
+					for (size_t i = 0; i < this->_t_count; ++i)
+					{
+						if (this->_t_partials[i].used)
+							init = this->_t_op(init, this->_t_partials[i].value);
+					}
+					return (init);
+				}
+		};
+
+		/**
+		 * Sort [first, last) with comp, or with the default order of ft::sort (radix sort for integers).
+		 */
+		template <class RandomIterator, class Compare>
+		void	sortRange (RandomIterator first, RandomIterator last, Compare comp, bool stable)
+		{
+			if (stable)
+				ft::stable_sort(first, last, comp);
+			else
+				ft::sort(first, last, comp);
+		}
+
+		template <class RandomIterator, class T, bool Radix>
+		void	sortRange (RandomIterator first, RandomIterator last, sortDefault<T, Radix>, bool stable)
+		{
+			if (stable)
+				ft::stable_sort(first, last);
+			else
+				ft::sort(first, last);
+		}
+
+		/**
+		 * Sorts the chunk [bounds[i], bounds[i + 1]) of the range for every index i.
+		 */
+		template <class RandomIterator, class Compare>
+		class	sortTask: public parallelTask
+		{
+			private:
+				RandomIterator	_t_first;
+				const size_t	*_t_bounds;
+				Compare			_t_comp;
+				bool			_t_stable;
+
+			public:
+				sortTask (RandomIterator first, const size_t *bounds, Compare comp, bool stable):
+					_t_first(first), _t_bounds(bounds), _t_comp(comp), _t_stable(stable) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+						sortRange(this->_t_first + this->_t_bounds[i], this->_t_first + this->_t_bounds[i + 1], this->_t_comp, this->_t_stable);
+				}
+		};
+
+		/**
+		 * Co-rank of k in the stable merge of a[0, na) and b[0, nb): the number i of elements of a
+		 * among the first k elements of the merge, the other k - i coming from b. Found by a binary
+		 * search, so that any slice of a merge can be written without merging what comes before it.
+		 */
+		template <class Source, class Compare>
+		size_t	coRank (Source a, size_t na, Source b, size_t nb, size_t k, Compare comp)
+		{
+			size_t	lo = k > nb ? k - nb : 0;
+			size_t	hi = k < na ? k : na;
+			size_t	i;
+
+			while (lo < hi)
+			{
+				i = lo + (hi - lo) / 2;
+				//a[i] comes before b[k - i - 1] in the merge (a wins ties): more of a is needed
+				if (!comp(b[k - i - 1], a[i]))
+					lo = i + 1;
+				else
+					hi = i;
+			}
+			return (lo);
+		}
+
+		/**
+		 * Merges the sorted runs of step chunks two by two, from source into destination: index s
+		 * writes the slice [bounds[s], bounds[s + 1]) of the merge it falls in, its inputs being
+		 * found with coRank(). Every round thus has one slice per chunk, however few merges are left.
+		 * A last run without a neighbour is copied.
+		 */
+		template <class Source, class Destination, class Compare>
+		class	mergeTask: public parallelTask
+		{
+			private:
+				Source			_t_src;
+				Destination		_t_dst;
+				const size_t	*_t_bounds;
+				size_t			_t_chunks;
+				size_t			_t_step;
+				Compare			_t_comp;
+
+				size_t	bound (size_t chunk) const
+				{
+					return (this->_t_bounds[chunk < this->_t_chunks ? chunk : this->_t_chunks]);
+				}
+
+			public:
+				mergeTask (Source src, Destination dst, const size_t *bounds, size_t chunks, size_t step, Compare comp):
+					_t_src(src), _t_dst(dst), _t_bounds(bounds), _t_chunks(chunks), _t_step(step), _t_comp(comp) {}
+
+				void	execute (size_t, size_t begin, size_t end)
+				{
+					size_t	pair;
+					size_t	lo;
+					size_t	mid;
+					size_t	hi;
+					size_t	k0;
+					size_t	k1;
+					size_t	i0;
+					size_t	i1;
+
+					for (size_t s = begin; s < end; ++s)
+					{
+						pair = s / (2 * this->_t_step);
+						lo = bound(2 * pair * this->_t_step);
+						mid = bound((2 * pair + 1) * this->_t_step);
+						hi = bound((2 * pair + 2) * this->_t_step);
+						k0 = this->_t_bounds[s] - lo;
+						k1 = this->_t_bounds[s + 1] - lo;
+						i0 = coRank(this->_t_src + lo, mid - lo, this->_t_src + mid, hi - mid, k0, this->_t_comp);
+						i1 = coRank(this->_t_src + lo, mid - lo, this->_t_src + mid, hi - mid, k1, this->_t_comp);
+						ft::merge(this->_t_src + lo + i0, this->_t_src + lo + i1, this->_t_src + mid + (k0 - i0), this->_t_src + mid + (k1 - i1),
+							this->_t_dst + lo + k0, this->_t_comp);
+					}
+				}
+		};
+
+		/**
+		 * Apply f to every element of [first, last), in no particular order.
+		 *
+		 * Every algorithm runs on the default pool, or on the pool given as first argument.
+		 */
+		template <class RandomIterator, class Function>
+		void	for_each (thread_pool &pool, RandomIterator first, RandomIterator last, Function f)
+		{
+			size_t	n = last - first;
+
+			if (n < PARALLEL_THRESHOLD)
+			{
+				std::for_each(first, last, f);
+				return ;
+			}
+			forEachTask<RandomIterator, Function>	task(first, f);
+
+			pool.run(task, n, grainSize(n, pool.size()));
+		}
+
+		template <class RandomIterator, class Function>
+		void	for_each (RandomIterator first, RandomIterator last, Function f)
+		{
+			ft::parallel::for_each(default_pool(), first, last, f);
+		}
+
+		/**
+		 * Store op(*it) in result[it - first] for every it of [first, last).
+		 *
+		 * @return : result + (last - first).
+		 */
+		template <class RandomIterator, class OutputIterator, class UnaryOperation>
+		OutputIterator	transform (thread_pool &pool, RandomIterator first, RandomIterator last, OutputIterator result, UnaryOperation op)
+		{
+			size_t	n = last - first;
+
+			if (n < PARALLEL_THRESHOLD)
+				return (std::transform(first, last, result, op));
+			transformTask<RandomIterator, OutputIterator, UnaryOperation>	task(first, result, op);
+
+			pool.run(task, n, grainSize(n, pool.size()));
+			return (result + n);
+		}
+
+		template <class RandomIterator, class OutputIterator, class UnaryOperation>
+		OutputIterator	transform (RandomIterator first, RandomIterator last, OutputIterator result, UnaryOperation op)
+		{
+			return (ft::parallel::transform(default_pool(), first, last, result, op));
+		}
+
+		/**
+		 * Store op(first1[i], first2[i]) in result[i] for every i of [0, last1 - first1).
+		 *
+		 * @return : result + (last1 - first1).
+		 */
+		template <class RandomIterator1, class RandomIterator2, class OutputIterator, class BinaryOperation>
+		OutputIterator	transform (thread_pool &pool, RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, OutputIterator result, BinaryOperation op)
+		{
+			size_t	n = last1 - first1;
+
+			if (n < PARALLEL_THRESHOLD)
+				return (std::transform(first1, last1, first2, result, op));
+			transform2Task<RandomIterator1, RandomIterator2, OutputIterator, BinaryOperation>	task(first1, first2, result, op);
+
+			pool.run(task, n, grainSize(n, pool.size()));
+			return (result + n);
+		}
+
+		template <class RandomIterator1, class RandomIterator2, class OutputIterator, class BinaryOperation>
+		OutputIterator	transform (RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, OutputIterator result, BinaryOperation op)
+		{
+			return (ft::parallel::transform(default_pool(), first1, last1, first2, result, op));
+		}
+
+		/**
+		 * Fold [first, last) into init with op.
+		 *
+		 * The elements are grouped in an unspecified order, so op must be associative and commutative
+		 * (a sum of floating point values may differ from the sequential one in its last bits).
+		 */
+		template <class RandomIterator, class T, class BinaryOperation>
+		T	reduce (thread_pool &pool, RandomIterator first, RandomIterator last, T init, BinaryOperation op)
+		{
+			size_t	n = last - first;
+
+			if (n < PARALLEL_THRESHOLD)
+			{
+				for (; first != last; ++first)
+					init = op(init, *first);
+				return (init);
+			}
+			reduceTask<RandomIterator, T, BinaryOperation>	task(first, op, pool.size());
+
+			pool.run(task, n, grainSize(n, pool.size()));
+			return (task.result(init));
+		}
+
+		template <class RandomIterator, class T, class BinaryOperation>
+		T	reduce (RandomIterator first, RandomIterator last, T init, BinaryOperation op)
+		{
+			return (ft::parallel::reduce(default_pool(), first, last, init, op));
+		}
+
+		template <class T>
+		struct	plus
+		{
+			T	operator() (const T &a, const T &b) const { return (a + b); }
+		};
+
+		/**
+		 * Sum of init and the elements of [first, last).
+		 */
+		template <class RandomIterator, class T>
+		T	reduce (thread_pool &pool, RandomIterator first, RandomIterator last, T init)
+		{
+			return (ft::parallel::reduce(pool, first, last, init, plus<T>()));
+		}
+
+		template <class RandomIterator, class T>
+		T	reduce (RandomIterator first, RandomIterator last, T init)
+		{
+			return (ft::parallel::reduce(default_pool(), first, last, init, plus<T>()));
+		}
+
+		/**
+		 * Assign val to every element of [first, last).
+		 */
+		template <class RandomIterator, class T>
+		void	fill (thread_pool &pool, RandomIterator first, RandomIterator last, const T &val)
+		{
+			size_t	n = last - first;
+
+			if (n < PARALLEL_THRESHOLD)
+			{
+				std::fill(first, last, val);
+				return ;
+			}
+			fillTask<RandomIterator, T>	task(first, val);
+
+			pool.run(task, n, grainSize(n, pool.size()));
+		}
+
+		template <class RandomIterator, class T>
+		void	fill (RandomIterator first, RandomIterator last, const T &val)
+		{
+			ft::parallel::fill(default_pool(), first, last, val);
+		}
+
+		/**
+		 * Copy [first, last) to the range starting at result, which must not overlap it.
+		 *
+		 * @return : result + (last - first).
+		 */
+		template <class RandomIterator, class OutputIterator>
+		OutputIterator	copy (thread_pool &pool, RandomIterator first, RandomIterator last, OutputIterator result)
+		{
+			size_t	n = last - first;
+
+			if (n < PARALLEL_THRESHOLD)
+				return (std::copy(first, last, result));
+			copyTask<RandomIterator, OutputIterator>	task(first, result);
+
+			pool.run(task, n, grainSize(n, pool.size()));
+			return (result + n);
+		}
+
+		template <class RandomIterator, class OutputIterator>
+		OutputIterator	copy (RandomIterator first, RandomIterator last, OutputIterator result)
+		{
+			return (ft::parallel::copy(default_pool(), first, last, result));
+		}
+
+		/**
+		 * Parallel merge sort.
+		 *
+		 * The range is cut in chunks (a few per thread) sorted in parallel, then the sorted runs
+		 * are merged two by two, back and forth between the range and a buffer. Each merge is
+		 * split at the chunk bounds with coRank(), so every round keeps all the threads busy, the
+		 * last one included. The merges are stable, so the whole sort is stable when the chunks
+		 * are stable sorted.
+		 */
+		template <class RandomIterator, class Compare>
+		void	mergeSort (thread_pool &pool, RandomIterator first, RandomIterator last, Compare comp, bool stable)
+		{
+			typedef typename iteratorValue<RandomIterator>::type	T;
+
+			size_t	n = last - first;
+			size_t	chunks;
+			bool	inBuffer = false;
+
+			if (n < PARALLEL_THRESHOLD || pool.size() < 2)
+			{
+				sortRange(first, last, comp, stable);
+				return ;
+			}
+			chunks = pool.size() * 4;
+			if (chunks > n / MIN_GRAIN)
+				chunks = n / MIN_GRAIN;
+
+			ft::vector<size_t>	bounds(chunks + 1);
+
+			for (size_t i = 0; i <= chunks; ++i)
+				bounds[i] = n / chunks * i + (i < n % chunks ? i : n % chunks);
+			{
+				sortTask<RandomIterator, Compare>	task(first, &bounds[0], comp, stable);
+
+				pool.run(task, chunks, 1);
+			}
+
+			//every element of the buffer is written by the first round: it needs no copy of the range
+			ft::vector<T>	buffer;
+			T				*tmp;
+
+			buffer.resize_default_init(n);
+			tmp = &buffer[0];
+			for (size_t step = 1; step < chunks; step *= 2)
+			{
+				if (inBuffer)
+				{
+					mergeTask<T *, RandomIterator, Compare>	task(tmp, first, &bounds[0], chunks, step, comp);
+
+					pool.run(task, chunks, 1);
+				}
+				else
+				{
+					mergeTask<RandomIterator, T *, Compare>	task(first, tmp, &bounds[0], chunks, step, comp);
+
+					pool.run(task, chunks, 1);
+				}
+				inBuffer = !inBuffer;
+			}
+			if (inBuffer)
+				ft::parallel::copy(pool, buffer.begin(), buffer.end(), first);
+		}
+
+		/**
+		 * Sort [first, last) with comp (see mergeSort). Equivalent elements may be reordered.
+		 */
+		template <class RandomIterator, class Compare>
+		void	sort (thread_pool &pool, RandomIterator first, RandomIterator last, Compare comp)
+		{
+			mergeSort(pool, first, last, comp, false);
+		}
+
+		template <class RandomIterator, class Compare>
+		void	sort (RandomIterator first, RandomIterator last, Compare comp)
+		{
+			mergeSort(default_pool(), first, last, comp, false);
+		}
+
+		/**
+		 * Sort [first, last) with operator<, its chunks being sorted by ft::sort (radix sort for integers).
+		 */
+		template <class RandomIterator>
+		void	sort (thread_pool &pool, RandomIterator first, RandomIterator last)
+		{
+			mergeSort(pool, first, last, sortDefault<typename iteratorValue<RandomIterator>::type>(), false);
+		}
+
+		template <class RandomIterator>
+		void	sort (RandomIterator first, RandomIterator last)
+		{
+			mergeSort(default_pool(), first, last, sortDefault<typename iteratorValue<RandomIterator>::type>(), false);
+		}
+
+		/**
+		 * Sort [first, last) with comp, equivalent elements keeping their order.
+		 */
+		template <class RandomIterator, class Compare>
+		void	stable_sort (thread_pool &pool, RandomIterator first, RandomIterator last, Compare comp)
+		{
+			mergeSort(pool, first, last, comp, true);
+		}
+
+		template <class RandomIterator, class Compare>
+		void	stable_sort (RandomIterator first, RandomIterator last, Compare comp)
+		{
+			mergeSort(default_pool(), first, last, comp, true);
+		}
+
+		template <class RandomIterator>
+		void	stable_sort (thread_pool &pool, RandomIterator first, RandomIterator last)
+		{
+			mergeSort(pool, first, last, sortDefault<typename iteratorValue<RandomIterator>::type>(), true);
+		}
+
+		template <class RandomIterator>
+		void	stable_sort (RandomIterator first, RandomIterator last)
+		{
+			mergeSort(default_pool(), first, last, sortDefault<typename iteratorValue<RandomIterator>::type>(), true);
+		}
+	}
+}
+
+#endif
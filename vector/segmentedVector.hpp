@@ -0,0 +1,459 @@
+#ifndef SEGMENTEDVECTOR_HPP
+# define SEGMENTEDVECTOR_HPP
+# include "../utils.hpp"
+# include "../reverse_iterator.hpp"
+# include <cstddef>
+# include <iterator>
+# include <memory>
+# include <stdexcept>
+
+namespace ft
+{
+	/**
+	 * Position of element i in the blocks of a segmented_vector whose first block holds First elements.
+	 *
+	 * Block k holds First << k elements, so element i is in the block given by the highest bit of i + First.
+	 */
+	template <size_t First>
+	struct	segment_index
+	{
+		static size_t	highBit(size_t x)
+		{
+# if defined(__GNUC__) || defined(__clang__)
+			return (sizeof(unsigned long) * 8 - 1 - __builtin_clzl(x));
+# else
+			size_t	bit = 0;
+
+			while (x >>= 1)
+				bit++;
+			return (bit);
+# endif
+		}
+
+		static size_t	firstBit(void) { return (highBit(First)); }
+		static size_t	block(size_t i) { return (highBit(i + First) - firstBit()); }
+		static size_t	offset(size_t i) { return (i + First - (static_cast<size_t>(1) << highBit(i + First))); }
+		static size_t	blockSize(size_t k) { return (First << k); }
+	};
+
+	/**
+	 * Random access iterator of segmented_vector.
+	 *
+	 * It is a position in the block table of its container, so like a vectorIterator
+	 * it is O(1) to dereference, move and compare, and it stays valid when the vector grows.
+	 * The table moves with the blocks when containers are swapped, so the iterator keeps
+	 * pointing to the same element, now in the other container.
+	 */
+	template <class T, class Ref, class Ptr, size_t First>
+	class	segmentedIterator
+	{
+		public:
+			typedef	T										value_type;
+			typedef	Ref										reference;
+			typedef	Ptr										pointer;
+			typedef	std::ptrdiff_t							difference_type;
+			typedef	std::random_access_iterator_tag			iterator_category;
+			typedef	segment_index<First>					index;
+
+		private:
+			T *const	*_i_blocks;
+			size_t		_i_index;
+
+			template <class U, class R, class P, size_t F>
+			friend class	segmentedIterator;
+
+		public:
+			segmentedIterator (void): _i_blocks(NULL), _i_index(0) {}
+			segmentedIterator (T *const *blocks, size_t i): _i_blocks(blocks), _i_index(i) {}
+
+			/**
+			 * Copy constructor, also converting an iterator to a const iterator.
+			 */
+			template <class R, class P>
+			segmentedIterator (const segmentedIterator<T, R, P, First> &it): _i_blocks(it._i_blocks), _i_index(it._i_index) {}
+
+			~segmentedIterator (void) {}
+
+			reference	operator* (void) const { return (_i_blocks[index::block(_i_index)][index::offset(_i_index)]); }
+			pointer		operator-> (void) const { return (&**this); }
+			reference	operator[] (difference_type n) const { return (*(*this + n)); }
+
+			segmentedIterator	&operator++ (void) { ++_i_index; return (*this); }
+			segmentedIterator	&operator-- (void) { --_i_index; return (*this); }
+			segmentedIterator	operator++ (int) { segmentedIterator it(*this); ++_i_index; return (it); }
+			segmentedIterator	operator-- (int) { segmentedIterator it(*this); --_i_index; return (it); }
+			segmentedIterator	&operator+= (difference_type n) { _i_index += n; return (*this); }
+			segmentedIterator	&operator-= (difference_type n) { _i_index -= n; return (*this); }
+			segmentedIterator	operator+ (difference_type n) const { return (segmentedIterator(_i_blocks, _i_index + n)); }
+			segmentedIterator	operator- (difference_type n) const { return (segmentedIterator(_i_blocks, _i_index - n)); }
+
+			template <class R, class P>
+			difference_type	operator- (const segmentedIterator<T, R, P, First> &it) const { return (_i_index - it._i_index); }
+
+			template <class R, class P>
+			bool	operator== (const segmentedIterator<T, R, P, First> &it) const { return (_i_index == it._i_index); }
+			template <class R, class P>
+			bool	operator!= (const segmentedIterator<T, R, P, First> &it) const { return (_i_index != it._i_index); }
+			template <class R, class P>
+			bool	operator< (const segmentedIterator<T, R, P, First> &it) const { return (_i_index < it._i_index); }
+			template <class R, class P>
+			bool	operator> (const segmentedIterator<T, R, P, First> &it) const { return (_i_index > it._i_index); }
+			template <class R, class P>
+			bool	operator<= (const segmentedIterator<T, R, P, First> &it) const { return (_i_index <= it._i_index); }
+			template <class R, class P>
+			bool	operator>= (const segmentedIterator<T, R, P, First> &it) const { return (_i_index >= it._i_index); }
+	};
+
+	/**
+	 * Vector whose elements never move.
+	 *
+	 * The elements are stored in blocks of First, 2 * First, 4 * First... elements, found through
+	 * a table of block pointers, allocated with the first block. Growing only adds a block: existing elements are never copied, so
+	 * pointers, references and iterators to them stay valid until they are popped.
+	 *
+	 * Elements can only be added or removed at the end, as anywhere else they would have to move.
+	 *
+	 * @First : the size of the first block, a power of two.
+	 */
+	template < class T, class Alloc = std::allocator<T>, size_t First = 16 >
+	class	segmented_vector
+	{
+		public:
+			typedef	T													value_type;
+			typedef	Alloc												allocator_type;
+			typedef	T													&reference;
+			typedef	T	const											&const_reference;
+			typedef	T*													pointer;
+			typedef	T	const*											const_pointer;
+			typedef	segmentedIterator<T, T &, T *, First>				iterator;
+			typedef	segmentedIterator<T, const T &, const T *, First>	const_iterator;
+			typedef ft::reverse_iterator<iterator>						reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+			typedef	ptrdiff_t											difference_type;
+			typedef	size_t												size_type;
+
+			static const size_type	MAX_BLOCKS = sizeof(size_type) * 8;
+
+		private:
+			typedef	segment_index<First>	index;
+			typedef	char					first_must_be_a_power_of_two[(First > 0 && (First & (First - 1)) == 0) ? 1 : -1];
+			typedef	typename Alloc::template rebind<value_type *>::other	table_allocator;
+
+			value_type		**_c_blocks;
+			allocator_type	_c_allocator;
+			size_type		_c_size;
+			size_type		_c_blockCount;
+
+			void			init(void)
+			{
+				this->_c_blocks = NULL;
+				this->_c_size = 0;
+				this->_c_blockCount = 0;
+			}
+
+			/**
+			 * Allocates one more block, doubling the capacity. Nothing is moved.
+			 *
+			 * The table of MAX_BLOCKS block pointers is allocated with the first block and never
+			 * reallocated, so the iterators can keep a pointer to it.
+			 */
+			void			addBlock(void)
+			{
+				if (this->_c_blockCount == MAX_BLOCKS - index::firstBit())
+					throw std::length_error("segmented_vector");
+				if (this->_c_blocks == NULL)
+					this->_c_blocks = table_allocator(this->_c_allocator).allocate(MAX_BLOCKS);
+				this->_c_blocks[this->_c_blockCount] = this->_c_allocator.allocate(index::blockSize(this->_c_blockCount));
+				this->_c_blockCount++;
+			}
+
+			value_type		*slot(size_type i) const
+			{
+				return (this->_c_blocks[index::block(i)] + index::offset(i));
+			}
+
+		public:
+
+		/**
+		 * Empty container constructor. Does not allocate.
+		 *
+		 * @param alloc : Allocator object
+		 */
+		explicit	segmented_vector (const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		{
+			init();
+		}
+
+		/**
+		 * Fill constructor
+		 *
+		 * @param n : Initial container size
+		 * @param val : Value to fill the container with
+		 * @param alloc : Allocator object
+		 */
+		explicit	segmented_vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		{
+			init();
+			resize(n, val);
+		}
+
+		/**
+		 * Range constructor.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a range.
+		 * @alloc : Allocator object.
+		 */
+		template <class InputIterator>
+		segmented_vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last, const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		{
+			init();
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @x : Another segmented_vector of the same type.
+		 */
+		segmented_vector (const segmented_vector& x): _c_allocator(x._c_allocator)
+		{
+			init();
+			reserve(x._c_size);
+			for (size_type i = 0; i < x._c_size; i++)
+				push_back(x[i]);
+		}
+
+		/**
+		 * Destructor of the container
+		 */
+		~segmented_vector (void)
+		{
+			clear();
+			for (size_type k = 0; k < this->_c_blockCount; k++)
+				this->_c_allocator.deallocate(this->_c_blocks[k], index::blockSize(k));
+			if (this->_c_blocks != NULL)
+				table_allocator(this->_c_allocator).deallocate(this->_c_blocks, MAX_BLOCKS);
+		}
+
+		/**
+		 * Assign content.
+		 *
+		 * The elements of x are copied into the blocks already allocated, which are kept.
+		 */
+		segmented_vector& operator= (const segmented_vector& x)
+		{
+			if (this != &x)
+			{
+				clear();
+				reserve(x._c_size);
+				for (size_type i = 0; i < x._c_size; i++)
+					push_back(x[i]);
+			}
+			return (*this);
+		}
+
+	//ITERATORS
+
+		iterator				begin (void) { return (iterator(this->_c_blocks, 0)); }
+		const_iterator			begin (void) const { return (const_iterator(this->_c_blocks, 0)); }
+		iterator				end (void) { return (iterator(this->_c_blocks, this->_c_size)); }
+		const_iterator			end (void) const { return (const_iterator(this->_c_blocks, this->_c_size)); }
+		reverse_iterator		rbegin (void) { return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin (void) const { return (const_reverse_iterator(end())); }
+		reverse_iterator		rend (void) { return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend (void) const { return (const_reverse_iterator(begin())); }
+
+	//CAPACITY METHODS
+
+		size_type	size (void) const { return (this->_c_size); }
+		size_type	max_size (void) const { return (this->_c_allocator.max_size()); }
+		bool		empty (void) const { return (this->_c_size == 0); }
+
+		/**
+		 * Return size of allocated storage capacity.
+		 *
+		 * @return : the number of elements the allocated blocks can hold.
+		 */
+		size_type	capacity (void) const
+		{
+			return (First * ((static_cast<size_type>(1) << this->_c_blockCount) - 1));
+		}
+
+		/**
+		 * Request a change in capacity.
+		 *
+		 * Allocates the blocks needed to hold n elements. The elements already there do not move.
+		 *
+		 * @n : Minimum capacity for the vector.
+		 */
+		void	reserve (size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("segmented_vector::reserve");
+			while (capacity() < n)
+				addBlock();
+		}
+
+		/**
+		 * Change size.
+		 *
+		 * @param n : New container size, expressed in number of elements.
+		 * @param val : Object whose content is copied to the added elements.
+		 */
+		void	resize (size_type n, value_type val = value_type())
+		{
+			reserve(n);
+			while (this->_c_size > n)
+				pop_back();
+			while (this->_c_size < n)
+				push_back(val);
+		}
+
+	//ELEMENT ACCESS METHODS
+
+		reference		operator[] (size_type n) { return (*slot(n)); }
+		const_reference	operator[] (size_type n) const { return (*slot(n)); }
+
+		reference at (size_type n)
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("segmented_vector::at");
+			return (*slot(n));
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("segmented_vector::at");
+			return (*slot(n));
+		}
+
+		reference		front (void) { return (*slot(0)); }
+		const_reference	front (void) const { return (*slot(0)); }
+		reference		back (void) { return (*slot(this->_c_size - 1)); }
+		const_reference	back (void) const { return (*slot(this->_c_size - 1)); }
+
+	//MODIFIERS METHODS
+
+		/**
+		 * Assign : Fill version
+		 *
+		 * @param n : New size for the container
+		 * @param val : Value to fill the container with.
+		 */
+		void	assign (size_type n, const value_type& val)
+		{
+			value_type	copy(val);
+
+			clear();
+			resize(n, copy);
+		}
+
+		/**
+		 * Assign : Range version.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a sequence.
+		 */
+		template <class InputIterator>
+		void	assign (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			clear();
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		/**
+		 * Add element at the end.
+		 *
+		 * When the blocks are full, a new block is added: no element is copied.
+		 *
+		 * @val : Value to be copied to the new element.
+		 */
+		void	push_back (const value_type& val)
+		{
+			if (this->_c_size == capacity())
+				addBlock();
+			this->_c_allocator.construct(slot(this->_c_size), val);
+			this->_c_size++;
+		}
+
+		/**
+		 * Delete last element.
+		 */
+		void	pop_back (void)
+		{
+			if (this->_c_size > 0)
+				this->_c_allocator.destroy(slot(--this->_c_size));
+		}
+
+		/**
+		 * Swap content.
+		 *
+		 * Exchanges the pointers to the block tables, no element is copied. Iterators,
+		 * pointers and references keep referring to the same elements, now in the other container.
+		 *
+		 * @x : Another segmented_vector of the same type.
+		 */
+		void	swap (segmented_vector& x)
+		{
+			std::swap(this->_c_blocks, x._c_blocks);
+			std::swap(this->_c_size, x._c_size);
+			std::swap(this->_c_blockCount, x._c_blockCount);
+		}
+
+		/**
+		 * Clear content.
+		 *
+		 * Destroys every element. The blocks are kept.
+		 */
+		void	clear (void)
+		{
+			while (this->_c_size > 0)
+				pop_back();
+		}
+
+		/**
+		 * Relational operators for segmented_vector.
+		 */
+		bool operator== (const segmented_vector& rhs) const
+		{
+			if (this->_c_size != rhs._c_size)
+				return (false);
+			for (size_type i = 0; i < this->_c_size; i++)
+				if (!((*this)[i] == rhs[i]))
+					return (false);
+			return (true);
+		}
+
+		bool operator< (const segmented_vector& rhs) const
+		{
+			for (size_type i = 0; i < this->_c_size && i < rhs._c_size; i++)
+			{
+				if ((*this)[i] < rhs[i])
+					return (true);
+				if (rhs[i] < (*this)[i])
+					return (false);
+			}
+			return (this->_c_size < rhs._c_size);
+		}
+
+		bool operator!= (const segmented_vector& rhs) const { return (!(*this == rhs)); }
+		bool operator<= (const segmented_vector& rhs) const { return (!(rhs < *this)); }
+		bool operator> (const segmented_vector& rhs) const { return (rhs < *this); }
+		bool operator>= (const segmented_vector& rhs) const { return (!(*this < rhs)); }
+	};
+
+	/**
+	 * Exchanges contents of segmented_vectors.
+	 *
+	 * @x/@y : segmented_vector containers of the same type.
+	 */
+	template<class T, class Alloc, size_t First>
+	void swap (segmented_vector<T,Alloc,First>& x, segmented_vector<T,Alloc,First>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
@@ -0,0 +1,307 @@
+#ifndef SETALGORITHMS_HPP
+# define SETALGORITHMS_HPP
+# include "vector.hpp"
+
+/**
+ * Algorithms on sorted ranges: merge, union, intersection and difference.
+ *
+ * They have the semantics of their <algorithm> counterparts, elements equivalent under comp
+ * being matched one for one, and accept any iterators, vectorIterator included.
+ * set_intersection gallops through the larger range when the sizes are skewed, and
+ * set_intersection_unique intersects strictly increasing ranges of 32 bits integers
+ * (posting lists) with an SSE2 kernel when both are contiguous.
+ */
+namespace	ft
+{
+	/**
+	 * Default comparison of the algorithms: operator<.
+	 */
+	struct	sorted_less
+	{
+		template <class A, class B>
+		bool	operator() (const A &a, const B &b) const { return (a < b); }
+	};
+
+	/**
+	 * Whether It walks over contiguous memory, so that &*first is an array of last - first elements.
+	 */
+	template <class It>
+	struct	is_contiguous_iterator { static const bool value = false; };
+	template <class T>
+	struct	is_contiguous_iterator<T *> { static const bool value = true; };
+	template <class T>
+	struct	is_contiguous_iterator<const T *> { static const bool value = true; };
+	template <class T>
+	struct	is_contiguous_iterator<vectorIterator<T> > { static const bool value = true; };
+	template <class T>
+	struct	is_contiguous_iterator<vectorConstIterator<T> > { static const bool value = true; };
+
+	template <class A, class B>
+	struct	sameType { static const bool value = false; };
+	template <class A>
+	struct	sameType<A, A> { static const bool value = true; };
+
+	/**
+	 * Merge sorted ranges.
+	 *
+	 * Copies the elements of both ranges to result, sorted; equivalent elements of the first range come first.
+	 *
+	 * @return : an iterator past the last element written.
+	 */
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	merge (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first2, *first1))
+				*result++ = *first2++;
+			else
+				*result++ = *first1++;
+		}
+		for (; first1 != last1; ++first1)
+			*result++ = *first1;
+		for (; first2 != last2; ++first2)
+			*result++ = *first2;
+		return (result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	merge (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return (ft::merge(first1, last1, first2, last2, result, sorted_less()));
+	}
+
+	/**
+	 * Union of two sorted ranges.
+	 *
+	 * Elements found in both ranges are copied once (from the first range) for each match.
+	 *
+	 * @return : an iterator past the last element written.
+	 */
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_union (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+				*result++ = *first1++;
+			else if (comp(*first2, *first1))
+				*result++ = *first2++;
+			else
+			{
+				*result++ = *first1++;
+				++first2;
+			}
+		}
+		for (; first1 != last1; ++first1)
+			*result++ = *first1;
+		for (; first2 != last2; ++first2)
+			*result++ = *first2;
+		return (result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_union (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return (ft::set_union(first1, last1, first2, last2, result, sorted_less()));
+	}
+
+	/**
+	 * Difference of two sorted ranges: the elements of the first range that have no match in the second.
+	 *
+	 * @return : an iterator past the last element written.
+	 */
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_difference (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+				*result++ = *first1++;
+			else if (comp(*first2, *first1))
+				++first2;
+			else
+			{
+				++first1;
+				++first2;
+			}
+		}
+		for (; first1 != last1; ++first1)
+			*result++ = *first1;
+		return (result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_difference (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return (ft::set_difference(first1, last1, first2, last2, result, sorted_less()));
+	}
+
+	/**
+	 * Below this ratio between the sizes of the ranges, set_intersection walks them side by side.
+	 */
+	static const size_t	GALLOP_RATIO = 32;
+
+	/**
+	 * First element of [first, last) not less than val, found by exponential then binary search:
+	 * the cost is logarithmic in the distance to the result instead of the length of the range.
+	 */
+	template <class RandomIterator, class T, class Compare>
+	RandomIterator	gallop (RandomIterator first, RandomIterator last, const T &val, Compare comp)
+	{
+		std::ptrdiff_t	n = last - first;
+		std::ptrdiff_t	lo = 0;
+		std::ptrdiff_t	hi = 1;
+		std::ptrdiff_t	mid;
+
+		while (hi < n && comp(first[hi], val))
+		{
+			lo = hi;
+			hi *= 2;
+		}
+		if (hi > n)
+			hi = n;
+		if (lo < n && !comp(first[lo], val))
+			return (first + lo);
+		//first[lo] < val, and first[hi] is not (or hi is n)
+		while (hi - lo > 1)
+		{
+			mid = lo + (hi - lo) / 2;
+			if (comp(first[mid], val))
+				lo = mid;
+			else
+				hi = mid;
+		}
+		return (first + hi);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	intersectLinear (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first1, *first2))
+				++first1;
+			else if (comp(*first2, *first1))
+				++first2;
+			else
+			{
+				*result++ = *first1++;
+				++first2;
+			}
+		}
+		return (result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	intersectRanges (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp,
+		std::input_iterator_tag, std::input_iterator_tag)
+	{
+		return (intersectLinear(first1, last1, first2, last2, result, comp));
+	}
+
+	/**
+	 * Intersection of random access ranges: each element of the smaller range is searched
+	 * by galloping in the larger one when it is more than GALLOP_RATIO times larger.
+	 */
+	template <class RandomIterator1, class RandomIterator2, class OutputIterator, class Compare>
+	OutputIterator	intersectRanges (RandomIterator1 first1, RandomIterator1 last1, RandomIterator2 first2, RandomIterator2 last2, OutputIterator result, Compare comp,
+		std::random_access_iterator_tag, std::random_access_iterator_tag)
+	{
+		size_t	n1 = last1 - first1;
+		size_t	n2 = last2 - first2;
+
+		if (n2 / GALLOP_RATIO > n1)
+		{
+			for (; first1 != last1 && first2 != last2; ++first1)
+			{
+				first2 = gallop(first2, last2, *first1, comp);
+				if (first2 != last2 && !comp(*first1, *first2))
+				{
+					*result++ = *first1;
+					++first2;
+				}
+			}
+			return (result);
+		}
+		if (n1 / GALLOP_RATIO > n2)
+		{
+			for (; first2 != last2 && first1 != last1; ++first2)
+			{
+				first1 = gallop(first1, last1, *first2, comp);
+				if (first1 != last1 && !comp(*first2, *first1))
+					*result++ = *first1++;
+			}
+			return (result);
+		}
+		return (intersectLinear(first1, last1, first2, last2, result, comp));
+	}
+
+	/**
+	 * Intersection of two sorted ranges: the elements of the first range that have a match in the second.
+	 *
+	 * @return : an iterator past the last element written.
+	 */
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator	set_intersection (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		return (intersectRanges(first1, last1, first2, last2, result, comp,
+			typename ft::iterator_category<InputIterator1>::type(), typename ft::iterator_category<InputIterator2>::type()));
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_intersection (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return (ft::set_intersection(first1, last1, first2, last2, result, sorted_less()));
+	}
+
+	/**
+	 * Chooses the SIMD kernel for contiguous ranges of 32 bits integers.
+	 */
+	template <class It1, class It2, bool Kernel = is_contiguous_iterator<It1>::value && is_contiguous_iterator<It2>::value
+		&& sameType<typename iteratorValue<It1>::type, typename iteratorValue<It2>::type>::value
+		&& is_integral<typename iteratorValue<It1>::type>::value && sizeof(typename iteratorValue<It1>::type) == 4>
+	struct	intersectUnique
+	{
+		template <class OutputIterator>
+		static OutputIterator	run (It1 first1, It1 last1, It2 first2, It2 last2, OutputIterator result)
+		{
+			return (ft::set_intersection(first1, last1, first2, last2, result));
+		}
+	};
+
+	template <class It1, class It2>
+	struct	intersectUnique<It1, It2, true>
+	{
+		template <class OutputIterator>
+		static OutputIterator	run (It1 first1, It1 last1, It2 first2, It2 last2, OutputIterator result)
+		{
+			size_t	n1 = last1 - first1;
+			size_t	n2 = last2 - first2;
+
+			if (n1 == 0 || n2 == 0)
+				return (result);
+			//skewed sizes are faster to gallop through
+			if (n1 / GALLOP_RATIO > n2 || n2 / GALLOP_RATIO > n1)
+				return (ft::set_intersection(first1, last1, first2, last2, result));
+			return (ft::simd::intersect32(&*first1, n1, &*first2, n2, result));
+		}
+	};
+
+	/**
+	 * Intersection of two strictly increasing ranges, such as posting lists.
+	 *
+	 * Same result as set_intersection, but the ranges must not hold duplicates. Contiguous
+	 * ranges (pointers, vectorIterator) of 32 bits integers of the same type are intersected
+	 * 4 by 4 elements with SSE2.
+	 *
+	 * @return : an iterator past the last element written.
+	 */
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator	set_intersection_unique (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return (intersectUnique<InputIterator1, InputIterator2>::run(first1, last1, first2, last2, result));
+	}
+}
+
+#endif
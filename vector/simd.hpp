@@ -0,0 +1,612 @@
+#ifndef SIMD_HPP
+# define SIMD_HPP
+# include <cstddef>
+# include <cstring>
+# include "../utils.hpp"
+
+# if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#  define FT_SIMD_X86 1
+#  include <immintrin.h>
+#  define FT_TARGET_AVX2 __attribute__((target("avx2")))
+# endif
+
+/**
+ * Search and comparison kernels used by ft::vector for arithmetic types.
+ *
+ * Integers, pointers and bool are compared bitwise, 16 bytes at a time with SSE2, or 32 bytes
+ * at a time with AVX2 when the CPU running the program has it (checked once, at the first call).
+ * Floating point values equal to a non-zero, non-NaN value have the same bits, so they are
+ * searched the same way; zeroes (+0 == -0) and NaNs (never equal) fall back to plain loops.
+ * Every other type, and every other CPU, uses plain loops.
+ */
+namespace	ft
+{
+	namespace	simd
+	{
+		enum	kind
+		{
+			scalar,		//compared with its operators only
+			bitwise,	//equal if and only if its bytes are equal
+			floating	//bitwise, except for zeroes and NaNs
+		};
+
+		template <class T>
+		struct	kind_of { static const int value = is_integral<T>::value ? bitwise : scalar; };
+		template <class T>
+		struct	kind_of<T *> { static const int value = bitwise; };
+		template <>
+		struct	kind_of<float> { static const int value = floating; };
+		template <>
+		struct	kind_of<double> { static const int value = floating; };
+
+		/**
+		 * Returns whether the CPU running the program supports AVX2.
+		 */
+		inline bool	has_avx2 (void)
+		{
+# ifdef FT_SIMD_X86
+			static const bool	avx2 = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+
+			return (avx2);
+# else
+			return (false);
+# endif
+		}
+
+# ifdef FT_SIMD_X86
+		inline size_t	lowBit (unsigned int mask)
+		{
+			return (__builtin_ctz(mask));
+		}
+
+		inline size_t	bitCount (unsigned int mask)
+		{
+			return (__builtin_popcount(mask));
+		}
+# endif
+
+		/**
+		 * Bitwise search of n words of W bytes.
+		 */
+		template <size_t W>
+		struct	words
+		{
+			static bool	same (const unsigned char *p, const unsigned char *val) { return (std::memcmp(p, val, W) == 0); }
+
+			static size_t	findScalar (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				size_t	i = 0;
+
+				while (i < n && !same(p + i * W, val))
+					i++;
+				return (i);
+			}
+
+			static size_t	countScalar (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				size_t	count = 0;
+
+				for (size_t i = 0; i < n; i++)
+					count += same(p + i * W, val);
+				return (count);
+			}
+
+# ifdef FT_SIMD_X86
+			static __m128i	set1 (const unsigned char *val);
+			static __m128i	equal (__m128i a, __m128i b);
+			FT_TARGET_AVX2 static __m256i	set1Avx2 (const unsigned char *val);
+			FT_TARGET_AVX2 static __m256i	equalAvx2 (__m256i a, __m256i b);
+
+			//every lane of W bytes equal to val sets W bits of the masks below
+			static size_t	findSse2 (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				const size_t	per = 16 / W;
+				__m128i			v = set1(val);
+				unsigned int	mask;
+				size_t			i = 0;
+
+				for (; i + per <= n; i += per)
+				{
+					mask = _mm_movemask_epi8(equal(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i * W)), v));
+					if (mask != 0)
+						return (i + lowBit(mask) / W);
+				}
+				return (i + findScalar(p + i * W, n - i, val));
+			}
+
+			FT_TARGET_AVX2 static size_t	findAvx2 (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				const size_t	per = 32 / W;
+				__m256i			v = set1Avx2(val);
+				unsigned int	mask;
+				size_t			i = 0;
+
+				for (; i + per <= n; i += per)
+				{
+					mask = _mm256_movemask_epi8(equalAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i * W)), v));
+					if (mask != 0)
+						return (i + lowBit(mask) / W);
+				}
+				return (i + findScalar(p + i * W, n - i, val));
+			}
+
+			static size_t	countSse2 (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				const size_t	per = 16 / W;
+				__m128i			v = set1(val);
+				size_t			bits = 0;
+				size_t			i = 0;
+
+				for (; i + per <= n; i += per)
+					bits += bitCount(_mm_movemask_epi8(equal(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i * W)), v)));
+				return (bits / W + countScalar(p + i * W, n - i, val));
+			}
+
+			FT_TARGET_AVX2 static size_t	countAvx2 (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				const size_t	per = 32 / W;
+				__m256i			v = set1Avx2(val);
+				size_t			bits = 0;
+				size_t			i = 0;
+
+				for (; i + per <= n; i += per)
+					bits += bitCount(_mm256_movemask_epi8(equalAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i * W)), v)));
+				return (bits / W + countScalar(p + i * W, n - i, val));
+			}
+
+			static size_t	find (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				return (has_avx2() ? findAvx2(p, n, val) : findSse2(p, n, val));
+			}
+
+			static size_t	count (const unsigned char *p, size_t n, const unsigned char *val)
+			{
+				return (has_avx2() ? countAvx2(p, n, val) : countSse2(p, n, val));
+			}
+# else
+			static size_t	find (const unsigned char *p, size_t n, const unsigned char *val) { return (findScalar(p, n, val)); }
+			static size_t	count (const unsigned char *p, size_t n, const unsigned char *val) { return (countScalar(p, n, val)); }
+# endif
+		};
+
+# ifdef FT_SIMD_X86
+		template <class Word>
+		inline Word	load (const unsigned char *val)
+		{
+			Word	w;
+
+			std::memcpy(&w, val, sizeof(w));
+			return (w);
+		}
+
+		template <> inline __m128i	words<1>::set1 (const unsigned char *val) { return (_mm_set1_epi8(load<char>(val))); }
+		template <> inline __m128i	words<2>::set1 (const unsigned char *val) { return (_mm_set1_epi16(load<short>(val))); }
+		template <> inline __m128i	words<4>::set1 (const unsigned char *val) { return (_mm_set1_epi32(load<int>(val))); }
+		template <> inline __m128i	words<8>::set1 (const unsigned char *val) { return (_mm_set1_epi64x(load<long long>(val))); }
+		template <> inline __m128i	words<1>::equal (__m128i a, __m128i b) { return (_mm_cmpeq_epi8(a, b)); }
+		template <> inline __m128i	words<2>::equal (__m128i a, __m128i b) { return (_mm_cmpeq_epi16(a, b)); }
+		template <> inline __m128i	words<4>::equal (__m128i a, __m128i b) { return (_mm_cmpeq_epi32(a, b)); }
+		//no 64 bits comparison in SSE2: both halves of a lane must be equal
+		template <> inline __m128i	words<8>::equal (__m128i a, __m128i b)
+		{
+			__m128i	halves = _mm_cmpeq_epi32(a, b);
+
+			return (_mm_and_si128(halves, _mm_shuffle_epi32(halves, 0xB1)));
+		}
+
+		template <> FT_TARGET_AVX2 inline __m256i	words<1>::set1Avx2 (const unsigned char *val) { return (_mm256_set1_epi8(load<char>(val))); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<2>::set1Avx2 (const unsigned char *val) { return (_mm256_set1_epi16(load<short>(val))); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<4>::set1Avx2 (const unsigned char *val) { return (_mm256_set1_epi32(load<int>(val))); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<8>::set1Avx2 (const unsigned char *val) { return (_mm256_set1_epi64x(load<long long>(val))); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<1>::equalAvx2 (__m256i a, __m256i b) { return (_mm256_cmpeq_epi8(a, b)); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<2>::equalAvx2 (__m256i a, __m256i b) { return (_mm256_cmpeq_epi16(a, b)); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<4>::equalAvx2 (__m256i a, __m256i b) { return (_mm256_cmpeq_epi32(a, b)); }
+		template <> FT_TARGET_AVX2 inline __m256i	words<8>::equalAvx2 (__m256i a, __m256i b) { return (_mm256_cmpeq_epi64(a, b)); }
+
+		/**
+		 * Returns the index of the first byte differing between a and b, or n.
+		 */
+		inline size_t	mismatchSse2 (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			unsigned int	mask;
+			size_t			i = 0;
+
+			for (; i + 16 <= n; i += 16)
+			{
+				mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)),
+					_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i))));
+				if (mask != 0xFFFF)
+					return (i + lowBit(~mask));
+			}
+			while (i < n && a[i] == b[i])
+				i++;
+			return (i);
+		}
+
+		FT_TARGET_AVX2 inline size_t	mismatchAvx2 (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			unsigned int	mask;
+			size_t			i = 0;
+
+			for (; i + 32 <= n; i += 32)
+			{
+				mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+					_mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i))));
+				if (mask != 0xFFFFFFFFu)
+					return (i + lowBit(~mask));
+			}
+			while (i < n && a[i] == b[i])
+				i++;
+			return (i);
+		}
+
+		inline size_t	mismatchBytes (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			return (has_avx2() ? mismatchAvx2(a, b, n) : mismatchSse2(a, b, n));
+		}
+# else
+		inline size_t	mismatchBytes (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			size_t	i = 0;
+
+			while (i < n && a[i] == b[i])
+				i++;
+			return (i);
+		}
+# endif
+
+		/**
+		 * Searches and comparisons of n elements of type T.
+		 */
+		template <class T, int Kind = kind_of<T>::value>
+		struct	search
+		{
+			static size_t	find (const T *p, size_t n, const T &val)
+			{
+				size_t	i = 0;
+
+				while (i < n && !(p[i] == val))
+					i++;
+				return (i);
+			}
+
+			static size_t	count (const T *p, size_t n, const T &val)
+			{
+				size_t	count = 0;
+
+				for (size_t i = 0; i < n; i++)
+					if (p[i] == val)
+						count++;
+				return (count);
+			}
+
+			static size_t	mismatch (const T *a, const T *b, size_t n)
+			{
+				size_t	i = 0;
+
+				while (i < n && a[i] == b[i])
+					i++;
+				return (i);
+			}
+
+			static bool	equal (const T *a, const T *b, size_t n)
+			{
+				return (mismatch(a, b, n) == n);
+			}
+		};
+
+		template <class T>
+		struct	search<T, bitwise>
+		{
+			static const unsigned char	*bytes (const T *p) { return (reinterpret_cast<const unsigned char *>(p)); }
+
+			static size_t	find (const T *p, size_t n, const T &val) { return (words<sizeof(T)>::find(bytes(p), n, bytes(&val))); }
+			static size_t	count (const T *p, size_t n, const T &val) { return (words<sizeof(T)>::count(bytes(p), n, bytes(&val))); }
+			static size_t	mismatch (const T *a, const T *b, size_t n) { return (mismatchBytes(bytes(a), bytes(b), n * sizeof(T)) / sizeof(T)); }
+			static bool		equal (const T *a, const T *b, size_t n) { return (n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0); }
+		};
+
+		template <class T>
+		struct	search<T, floating>
+		{
+			static bool		plain (const T &val) { return (val != val || val == 0); }
+
+			static size_t	find (const T *p, size_t n, const T &val)
+			{
+				if (plain(val))
+					return (search<T, scalar>::find(p, n, val));
+				return (search<T, bitwise>::find(p, n, val));
+			}
+
+			static size_t	count (const T *p, size_t n, const T &val)
+			{
+				if (plain(val))
+					return (search<T, scalar>::count(p, n, val));
+				return (search<T, bitwise>::count(p, n, val));
+			}
+
+			static size_t	mismatch (const T *a, const T *b, size_t n) { return (search<T, scalar>::mismatch(a, b, n)); }
+			static bool		equal (const T *a, const T *b, size_t n) { return (search<T, scalar>::equal(a, b, n)); }
+		};
+
+		/**
+		 * Index of the first element equal to val in p[0, n), or n.
+		 */
+		template <class T>
+		size_t	find (const T *p, size_t n, const T &val) { return (search<T>::find(p, n, val)); }
+
+		/**
+		 * Number of elements equal to val in p[0, n).
+		 */
+		template <class T>
+		size_t	count (const T *p, size_t n, const T &val) { return (search<T>::count(p, n, val)); }
+
+		/**
+		 * Index of the first element of a[0, n) that is not equal to the one of b, or n.
+		 */
+		template <class T>
+		size_t	mismatch (const T *a, const T *b, size_t n) { return (search<T>::mismatch(a, b, n)); }
+
+		/**
+		 * Whether a[0, n) and b[0, n) are equal element by element.
+		 */
+		template <class T>
+		bool	equal (const T *a, const T *b, size_t n) { return (search<T>::equal(a, b, n)); }
+
+		/**
+		 * Reduction of p[0, n) to its least (Least) or greatest element.
+		 *
+		 * Returns the index of the first such element, n being at least 1.
+		 */
+		template <class T, bool Least>
+		struct	extremum
+		{
+			static bool		better (const T &a, const T &b) { return (Least ? a < b : b < a); }
+
+			static size_t	index (const T *p, size_t n)
+			{
+				size_t	best = 0;
+
+				for (size_t i = 1; i < n; i++)
+					if (better(p[i], p[best]))
+						best = i;
+				return (best);
+			}
+		};
+
+# ifdef FT_SIMD_X86
+		/**
+		 * AVX2 reduction for the integer types having a vector min and max instruction:
+		 * the extremum value is computed 32 bytes at a time, then located with find().
+		 */
+#  define FT_SIMD_EXTREMUM(Type, Min, Max) \
+		template <bool Least> \
+		struct	extremum<Type, Least> \
+		{ \
+			FT_TARGET_AVX2 static Type	reduce (const Type *p, size_t n) \
+			{ \
+				const size_t	per = 32 / sizeof(Type); \
+				__m256i			acc = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); \
+				Type			lanes[32 / sizeof(Type)]; \
+				Type			best; \
+				size_t			i = per; \
+\
+				for (; i + per <= n; i += per) \
+				{ \
+					__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)); \
+					acc = Least ? Min(acc, x) : Max(acc, x); \
+				} \
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc); \
+				best = lanes[0]; \
+				for (size_t j = 1; j < per; j++) \
+					best = (Least ? lanes[j] < best : best < lanes[j]) ? lanes[j] : best; \
+				for (; i < n; i++) \
+					best = (Least ? p[i] < best : best < p[i]) ? p[i] : best; \
+				return (best); \
+			} \
+\
+			static size_t	index (const Type *p, size_t n) \
+			{ \
+				size_t	best = 0; \
+\
+				if (n >= 32 / sizeof(Type) && has_avx2()) \
+					return (simd::find(p, n, reduce(p, n))); \
+				for (size_t i = 1; i < n; i++) \
+					if (Least ? p[i] < p[best] : p[best] < p[i]) \
+						best = i; \
+				return (best); \
+			} \
+		};
+
+		FT_SIMD_EXTREMUM(signed char, _mm256_min_epi8, _mm256_max_epi8)
+		FT_SIMD_EXTREMUM(unsigned char, _mm256_min_epu8, _mm256_max_epu8)
+		FT_SIMD_EXTREMUM(short, _mm256_min_epi16, _mm256_max_epi16)
+		FT_SIMD_EXTREMUM(unsigned short, _mm256_min_epu16, _mm256_max_epu16)
+		FT_SIMD_EXTREMUM(int, _mm256_min_epi32, _mm256_max_epi32)
+		FT_SIMD_EXTREMUM(unsigned int, _mm256_min_epu32, _mm256_max_epu32)
+#  undef FT_SIMD_EXTREMUM
+# endif
+
+		/**
+		 * Index of the first least element of p[0, n), n being at least 1.
+		 */
+		template <class T>
+		size_t	min_index (const T *p, size_t n) { return (extremum<T, true>::index(p, n)); }
+
+		/**
+		 * Index of the first greatest element of p[0, n), n being at least 1.
+		 */
+		template <class T>
+		size_t	max_index (const T *p, size_t n) { return (extremum<T, false>::index(p, n)); }
+
+		/**
+		 * Word kernels of the packed ft::vector<bool>.
+		 *
+		 * logical<Op>::apply computes dst[i] = dst[i] Op src[i] over n words, 16 or 32 bytes at a time,
+		 * and popcount counts the bits set in n words with the POPCNT instruction when the CPU has it.
+		 */
+		enum	logic
+		{
+			logic_and,
+			logic_or,
+			logic_xor
+		};
+
+		template <int Op>
+		struct	logical
+		{
+			static unsigned long	word (unsigned long a, unsigned long b)
+			{
+				return (Op == logic_and ? a & b : Op == logic_or ? a | b : a ^ b);
+			}
+
+			static void	applyScalar (unsigned long *dst, const unsigned long *src, size_t n)
+			{
+				for (size_t i = 0; i < n; i++)
+					dst[i] = word(dst[i], src[i]);
+			}
+
+# ifdef FT_SIMD_X86
+			static __m128i	sse2 (__m128i a, __m128i b)
+			{
+				return (Op == logic_and ? _mm_and_si128(a, b) : Op == logic_or ? _mm_or_si128(a, b) : _mm_xor_si128(a, b));
+			}
+
+			FT_TARGET_AVX2 static __m256i	avx2 (__m256i a, __m256i b)
+			{
+				return (Op == logic_and ? _mm256_and_si256(a, b) : Op == logic_or ? _mm256_or_si256(a, b) : _mm256_xor_si256(a, b));
+			}
+
+			static void	applySse2 (unsigned long *dst, const unsigned long *src, size_t n)
+			{
+				const size_t	per = 16 / sizeof(unsigned long);
+				size_t			i = 0;
+
+				for (; i + per <= n; i += per)
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i)),
+						_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i))));
+				applyScalar(dst + i, src + i, n - i);
+			}
+
+			FT_TARGET_AVX2 static void	applyAvx2 (unsigned long *dst, const unsigned long *src, size_t n)
+			{
+				const size_t	per = 32 / sizeof(unsigned long);
+				size_t			i = 0;
+
+				for (; i + per <= n; i += per)
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i)),
+						_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i))));
+				applyScalar(dst + i, src + i, n - i);
+			}
+
+			static void	apply (unsigned long *dst, const unsigned long *src, size_t n)
+			{
+				if (has_avx2())
+					applyAvx2(dst, src, n);
+				else
+					applySse2(dst, src, n);
+			}
+# else
+			static void	apply (unsigned long *dst, const unsigned long *src, size_t n) { applyScalar(dst, src, n); }
+# endif
+		};
+
+		inline size_t	popcountScalar (const unsigned long *p, size_t n)
+		{
+			size_t	bits = 0;
+
+			for (size_t i = 0; i < n; i++)
+				bits += __builtin_popcountl(p[i]);
+			return (bits);
+		}
+
+# ifdef FT_SIMD_X86
+		__attribute__((target("popcnt"))) inline size_t	popcountHardware (const unsigned long *p, size_t n)
+		{
+			size_t	bits = 0;
+
+			for (size_t i = 0; i < n; i++)
+				bits += __builtin_popcountl(p[i]);
+			return (bits);
+		}
+
+		inline size_t	popcount (const unsigned long *p, size_t n)
+		{
+			static const bool	hardware = (__builtin_cpu_init(), __builtin_cpu_supports("popcnt") != 0);
+
+			return (hardware ? popcountHardware(p, n) : popcountScalar(p, n));
+		}
+# else
+		inline size_t	popcount (const unsigned long *p, size_t n) { return (popcountScalar(p, n)); }
+# endif
+
+		//merge intersection of two increasing arrays, one comparison per step
+		template <class T, class OutputIterator>
+		OutputIterator	intersectScalar (const T *a, size_t na, const T *b, size_t nb, OutputIterator out)
+		{
+			size_t	i = 0;
+			size_t	j = 0;
+
+			while (i < na && j < nb)
+			{
+				if (a[i] < b[j])
+					i++;
+				else if (b[j] < a[i])
+					j++;
+				else
+				{
+					*out++ = a[i++];
+					j++;
+				}
+			}
+			return (out);
+		}
+
+# ifdef FT_SIMD_X86
+		/**
+		 * Intersection of two strictly increasing arrays of 32 bits integers, written to out.
+		 *
+		 * Blocks of 4 elements of a are compared with blocks of 4 elements of b, all 16 pairs
+		 * at once: b is rotated three times, and the lanes of a equal to any lane of b are the
+		 * common elements. The block ending with the smaller element is then skipped (both when they end alike).
+		 */
+		template <class T, class OutputIterator>
+		OutputIterator	intersect32 (const T *a, size_t na, const T *b, size_t nb, OutputIterator out)
+		{
+			size_t			i = 0;
+			size_t			j = 0;
+			__m128i			va;
+			__m128i			vb;
+			__m128i			eq;
+			unsigned int	mask;
+			T				amax;
+			T				bmax;
+
+			while (i + 4 <= na && j + 4 <= nb)
+			{
+				va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+				vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+				eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39))),
+					_mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4E)), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93))));
+				for (mask = _mm_movemask_ps(_mm_castsi128_ps(eq)); mask != 0; mask &= mask - 1)
+					*out++ = a[i + lowBit(mask)];
+				amax = a[i + 3];
+				bmax = b[j + 3];
+				if (!(bmax < amax))
+					i += 4;
+				if (!(amax < bmax))
+					j += 4;
+			}
+			return (intersectScalar(a + i, na - i, b + j, nb - j, out));
+		}
+# else
+		template <class T, class OutputIterator>
+		OutputIterator	intersect32 (const T *a, size_t na, const T *b, size_t nb, OutputIterator out)
+		{
+			return (intersectScalar(a, na, b, nb, out));
+		}
+# endif
+	}
+}
+
+#endif
@@ -0,0 +1,490 @@
+#ifndef SMALLVECTOR_HPP
+# define SMALLVECTOR_HPP
+# include "vector.hpp"
+
+namespace ft
+{
+	/**
+	 * Vector keeping up to N elements inside the object itself.
+	 *
+	 * The first N elements live in an inline buffer, so a small_vector that never
+	 * grows past N does not allocate at all. When it overflows, the elements are
+	 * moved to heap storage obtained from Alloc and the vector behaves like ft::vector.
+	 *
+	 * @N : the number of elements stored inline.
+	 * @Growth : the growth policy of the heap storage (see growthPolicy.hpp).
+	 */
+	template < class T, size_t N, class Alloc = std::allocator<T>, class Growth = ft::grow_double >
+	class	small_vector
+	{
+		public:
+			typedef	T										value_type;
+			typedef	Alloc									allocator_type;
+			typedef	T										&reference;
+			typedef	T	const								&const_reference;
+			typedef	T*										pointer;
+			typedef	T*	const								const_pointer;
+			typedef	vectorIterator<T>						iterator;
+			typedef	vectorConstIterator<T>					const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef	ptrdiff_t								difference_type;
+			typedef	size_t									size_type;
+			typedef	Growth									growth_policy;
+
+			static const size_type	inline_capacity = N;
+
+		protected:
+			value_type						*_c_container;
+			allocator_type					_c_allocator;
+			size_type						_c_size;
+			size_type						_c_capacity;
+			ft::aligned_buffer<T, N>		_c_inline;
+
+		private:
+			value_type		*inlineData(void) { return (this->_c_inline.data()); }
+
+			size_t			more_capacity(size_t new1)
+			{
+				return (ft::growCapacity<Growth>(this->_c_capacity, new1, max_size(), sizeof(value_type)));
+			}
+
+			/**
+			 * Moves the elements to heap storage of new_capacity elements.
+			 * The inline buffer is never deallocated.
+			 */
+			void			realloc(size_type new_capacity)
+			{
+				value_type	*tmp = this->_c_allocator.allocate(new_capacity);
+
+				try
+				{
+					ft::relocate(this->_c_allocator, tmp, this->_c_container, this->_c_size);
+				}
+				catch (...)
+				{
+					this->_c_allocator.deallocate(tmp, new_capacity);
+					throw ;
+				}
+				if (!is_inline())
+					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = tmp;
+				this->_c_capacity = new_capacity;
+			}
+
+			/**
+			 * Makes room for n uninitialized elements at index pos (see ft::vector).
+			 */
+			void			openGap(size_type pos, size_type n)
+			{
+				if (n == 0)
+					return ;
+				if (this->_c_size + n > this->_c_capacity)
+					realloc(more_capacity(this->_c_size + n));
+				ft::relocate(this->_c_allocator, this->_c_container + pos + n, this->_c_container + pos, this->_c_size - pos);
+				this->_c_size += n;
+			}
+
+			/**
+			 * Range assignment and insertion, dispatched on the iterator category as in ft::vector:
+			 * a single-pass range is appended as it is read, a forward range is measured first.
+			 */
+			template <class InputIterator>
+			void			assignRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				clear();
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			template <class ForwardIterator>
+			void			assignRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = ft::rangeLength(first, last, typename ft::iterator_category<ForwardIterator>::type());
+
+				clear();
+				reserve(n);
+				ft::copyRange(this->_c_allocator, this->_c_container, first, n);
+				this->_c_size = n;
+			}
+
+			template <class InputIterator>
+			void			insertRange(size_type pos, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				size_type	old_size = this->_c_size;
+
+				for (; first != last; ++first)
+					push_back(*first);
+				std::rotate(this->_c_container + pos, this->_c_container + old_size, this->_c_container + this->_c_size);
+			}
+
+			template <class ForwardIterator>
+			void			insertRange(size_type pos, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = ft::rangeLength(first, last, typename ft::iterator_category<ForwardIterator>::type());
+
+				openGap(pos, n);
+				ft::copyRange(this->_c_allocator, this->_c_container + pos, first, n);
+			}
+
+			void			init(void)
+			{
+				this->_c_container = inlineData();
+				this->_c_size = 0;
+				this->_c_capacity = N;
+			}
+
+		public:
+
+		/**
+		 * Empty container constructor
+		 *
+		 * Constructs an empty container, with no elements. Does not allocate.
+		 *
+		 * @param alloc : Allocator object
+		 */
+		explicit	small_vector (const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		{
+			init();
+		}
+
+		/**
+		 * Fill constructor
+		 *
+		 * Constructs a container with n elements. Each element is a copy of val.
+		 *
+		 * @param n : Initial container size
+		 * @param val : Value to fill the container with
+		 * @param alloc : Allocator object
+		 */
+		explicit	small_vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		{
+			init();
+			insert(end(), n, val);
+		}
+
+		/**
+		 * Range constructor.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a range.
+		 * @alloc : Allocator object.
+		 */
+		template <class InputIterator>
+		small_vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last, const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		{
+			init();
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		/**
+		 * Copy constructor.
+		 *
+		 * The copy keeps its elements inline whenever they fit, whatever the storage of x.
+		 *
+		 * @x : Another small_vector object of the same type.
+		 */
+		small_vector (const small_vector& x): _c_allocator(x._c_allocator)
+		{
+			init();
+			reserve(x._c_size);
+			try
+			{
+				ft::copyConstruct(this->_c_allocator, this->_c_container, x._c_container, x._c_size);
+			}
+			catch (...)
+			{
+				if (!is_inline())
+					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				throw ;
+			}
+			this->_c_size = x._c_size;
+		}
+
+		/**
+		 * Destructor of the container
+		 */
+		~small_vector (void)
+		{
+			clear();
+			if (!is_inline())
+				this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+		}
+
+		small_vector& operator= (const small_vector& x)
+		{
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return (*this);
+		}
+
+	//ITERATORS
+
+		iterator				begin (void) { return (iterator(this->_c_container)); }
+		const_iterator			begin (void) const { return (const_iterator(this->_c_container)); }
+		iterator				end (void) { return (iterator(this->_c_container + this->_c_size)); }
+		const_iterator			end (void) const { return (const_iterator(this->_c_container + this->_c_size)); }
+		reverse_iterator		rbegin (void) { return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin (void) const { return (const_reverse_iterator(end())); }
+		reverse_iterator		rend (void) { return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend (void) const { return (const_reverse_iterator(begin())); }
+
+	//CAPACITY METHODS
+
+		size_type	size (void) const { return (this->_c_size); }
+		size_type	max_size (void) const { return (this->_c_allocator.max_size()); }
+		size_type	capacity (void) const { return (this->_c_capacity); }
+		bool		empty (void) const { return (this->_c_size == 0); }
+
+		/**
+		 * Test whether the elements are stored in the inline buffer.
+		 *
+		 * @return : true until the vector has grown past N elements.
+		 */
+		bool	is_inline (void) const
+		{
+			return (this->_c_container == this->_c_inline.data());
+		}
+
+		/**
+		 * Change size.
+		 *
+		 * @param n : New container size, expressed in number of elements.
+		 * @param val : Object whose content is copied to the added elements.
+		 */
+		void resize (size_type n, value_type val = value_type())
+		{
+			if (n < this->_c_size)
+				erase(begin() + n, end());
+			else
+				insert(end(), n - this->_c_size, val);
+		}
+
+		/**
+		 * Request a change in capacity.
+		 *
+		 * Moves the elements to the heap if n is greater than the current capacity.
+		 *
+		 * @n : Minimum capacity for the vector.
+		 */
+		void reserve (size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("small_vector::reserve");
+			if (n > this->_c_capacity)
+				realloc(n);
+		}
+
+	//ELEMENT ACCESS METHODS
+
+		reference		operator[] (size_type n) { return (this->_c_container[n]); }
+		const_reference	operator[] (size_type n) const { return (this->_c_container[n]); }
+
+		reference at (size_type n)
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("small_vector::at");
+			return (this->_c_container[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("small_vector::at");
+			return (this->_c_container[n]);
+		}
+
+		reference		front (void) { return (this->_c_container[0]); }
+		const_reference	front (void) const { return (this->_c_container[0]); }
+		reference		back (void) { return (this->_c_container[this->_c_size - 1]); }
+		const_reference	back (void) const { return (this->_c_container[this->_c_size - 1]); }
+
+	//MODIFIERS METHODS
+
+		/**
+		 * Assign : Fill version
+		 *
+		 * @param n : New size for the container
+		 * @param val : Value to fill the container with.
+		 */
+		void assign (size_type n, const value_type& val)
+		{
+			value_type	copy(val);
+
+			clear();
+			insert(end(), n, copy);
+		}
+
+		/**
+		 * Assign : Range version.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a sequence.
+		 */
+		template <class InputIterator>
+		void assign (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		/**
+		 * Add element at the end.
+		 *
+		 * @val : Value to be copied to the new element.
+		 */
+		void push_back (const value_type& val)
+		{
+			if (this->_c_size < this->_c_capacity)
+			{
+				this->_c_allocator.construct(this->_c_container + this->_c_size, val);
+				this->_c_size++;
+			}
+			else
+				insert(end(), val);
+		}
+
+		/**
+		 * Delete last element.
+		 */
+		void pop_back (void)
+		{
+			if (this->_c_size > 0)
+				this->_c_allocator.destroy(&this->_c_container[--this->_c_size]);
+		}
+
+		/**
+		 * Insert elements. (single element)
+		 *
+		 * @param position : Position in the vector where the new element is inserted.
+		 * @param val : Value to be copied to the inserted element.
+		 * @return : An iterator that points to the newly inserted element.
+		 */
+		iterator insert (iterator position, const value_type& val)
+		{
+			size_type	pos = position - begin();
+			value_type	copy(val);
+
+			openGap(pos, 1);
+			this->_c_allocator.construct(this->_c_container + pos, copy);
+			return (begin() + pos);
+		}
+
+		/**
+		 * Insert elements. (fill)
+		 *
+		 * @position : Position in the vector where the new elements are inserted.
+		 * @n : Number of elements to insert.
+		 * @val : Value to be copied to the inserted elements.
+		 */
+		void insert (iterator position, size_type n, const value_type& val)
+		{
+			size_type	pos = position - begin();
+			value_type	copy(val);
+
+			openGap(pos, n);
+			ft::fillConstruct(this->_c_allocator, this->_c_container + pos, n, copy);
+		}
+
+		/**
+		 * Insert elements. (range)
+		 *
+		 * @position : Position in the vector where the new elements are inserted.
+		 * @first/@last : Iterators specifying a range of elements.
+		 */
+		template <class InputIterator>
+		void insert (iterator position, InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			insertRange(position - begin(), first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		/**
+		 * Erase elements.
+		 *
+		 * @position : Iterator pointing to a single element to be removed from the vector.
+		 * @return : An iterator pointing to the element that followed the erased one.
+		 */
+		iterator erase (iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		/**
+		 * Erase elements.
+		 *
+		 * @first/@last : Iterators specifying a range within the vector to be removed: [first,last).
+		 * @return : An iterator pointing to the element that followed the last erased one.
+		 */
+		iterator erase (iterator first, iterator last)
+		{
+			size_type	pos = first - begin();
+			size_type	n = last - first;
+
+			ft::eraseGap(this->_c_allocator, this->_c_container, this->_c_size, pos, n);
+			this->_c_size -= n;
+			return (begin() + pos);
+		}
+
+		/**
+		 * Swap content.
+		 *
+		 * Two heap buffers are exchanged in constant time. When one of the vectors
+		 * is inline, its elements have to be copied into the other one.
+		 *
+		 * @x : Another small_vector of the same type.
+		 */
+		void swap (small_vector& x)
+		{
+			if (!is_inline() && !x.is_inline())
+			{
+				std::swap(this->_c_container, x._c_container);
+				std::swap(this->_c_size, x._c_size);
+				std::swap(this->_c_capacity, x._c_capacity);
+				return ;
+			}
+
+			small_vector	tmp(*this);
+
+			*this = x;
+			x = tmp;
+		}
+
+		/**
+		 * Clear content.
+		 *
+		 * Destroys every element. The storage is kept.
+		 */
+		void clear (void)
+		{
+			erase(begin(), end());
+		}
+
+		/**
+		 * Relational operators for small_vector.
+		 */
+		bool operator== (const small_vector& rhs) const
+		{
+			return (ft::storageEqual(this->_c_container, this->_c_size, rhs._c_container, rhs._c_size));
+		}
+
+		bool operator< (const small_vector& rhs) const
+		{
+			return (ft::storageLess(this->_c_container, this->_c_size, rhs._c_container, rhs._c_size));
+		}
+
+		bool operator!= (const small_vector& rhs) const { return (!(*this == rhs)); }
+		bool operator<= (const small_vector& rhs) const { return (!(rhs < *this)); }
+		bool operator> (const small_vector& rhs) const { return (rhs < *this); }
+		bool operator>= (const small_vector& rhs) const { return (!(*this < rhs)); }
+	};
+
+	/**
+	 * Exchanges contents of small_vectors.
+	 *
+	 * @x/@y : small_vector containers of the same type.
+	 */
+	template<class T, size_t N, class Alloc, class Growth>
+	void swap (small_vector<T,N,Alloc,Growth>& x, small_vector<T,N,Alloc,Growth>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
@@ -0,0 +1,435 @@
+#ifndef SOAVECTOR_HPP
+# define SOAVECTOR_HPP
+# include "vector.hpp"
+
+namespace	ft
+{
+	/**
+	 * Placeholder for the unused fields of an ft::soa_vector.
+	 */
+	struct	soa_none {};
+
+	/**
+	 * View of a contiguous column of an ft::soa_vector.
+	 *
+	 * It is a plain pointer and a length, so a loop over it is a loop over an array, which the
+	 * compiler can vectorize. It is invalidated like the iterators of ft::vector.
+	 */
+	template <class T>
+	class	soa_span
+	{
+		public:
+			typedef	T			value_type;
+			typedef	T			*iterator;
+			typedef	size_t		size_type;
+
+		private:
+			T			*_s_data;
+			size_type	_s_size;
+
+		public:
+			soa_span (T *data, size_type size): _s_data(data), _s_size(size) {}
+
+			T			*data (void) const { return (this->_s_data); }
+			size_type	size (void) const { return (this->_s_size); }
+			bool		empty (void) const { return (this->_s_size == 0); }
+			iterator	begin (void) const { return (this->_s_data); }
+			iterator	end (void) const { return (this->_s_data + this->_s_size); }
+			T			&operator[] (size_type i) const { return (this->_s_data[i]); }
+	};
+
+	/**
+	 * One column of an ft::soa_vector, and the empty column standing for soa_none.
+	 */
+	template <class T, class Growth>
+	struct	soaColumn
+	{
+		ft::vector<T, std::allocator<T>, Growth>	values;
+
+		void	push_back (const T &val) { this->values.push_back(val); }
+		void	pop_back (void) { this->values.pop_back(); }
+		void	erase (size_t pos) { this->values.erase(this->values.begin() + pos); }
+		void	resize (size_t n) { this->values.resize(n); }
+		void	reserve (size_t n) { this->values.reserve(n); }
+		void	shrink_to_fit (void) { this->values.shrink_to_fit(); }
+		void	clear (void) { this->values.clear(); }
+		void	swap (soaColumn &x) { this->values.swap(x.values); }
+		size_t	memory_usage (void) const { return (this->values.memory_usage()); }
+	};
+
+	template <class Growth>
+	struct	soaColumn<soa_none, Growth>
+	{
+		void	push_back (const soa_none &) {}
+		void	pop_back (void) {}
+		void	erase (size_t) {}
+		void	resize (size_t) {}
+		void	reserve (size_t) {}
+		void	shrink_to_fit (void) {}
+		void	clear (void) {}
+		void	swap (soaColumn &) {}
+		size_t	memory_usage (void) const { return (0); }
+	};
+
+	template <class Soa>
+	class	soaRow;
+
+	template <class Soa>
+	class	soaConstRow;
+
+	/**
+	 * Structure of arrays: a table of up to 6 fields, each field stored in its own ft::vector.
+	 *
+	 * A scan reading one field only touches the bytes of that field, and column<I>() hands out
+	 * the contiguous array of field I. Rows are reached through proxies: v[i].get<I>().
+	 *
+	 * @T0...T5 : the types of the fields, the unused ones being left to soa_none.
+	 * @Growth : the growth policy of the columns (see growthPolicy.hpp).
+	 *
+	 * ft::soa_vector<int, float, char> v;
+	 * v.push_back(1, 2.5f, 'a');
+	 * float *f = v.column<1>().data();
+	 */
+	template < class T0, class T1 = soa_none, class T2 = soa_none, class T3 = soa_none,
+		class T4 = soa_none, class T5 = soa_none, class Growth = ft::grow_double >
+	class	soa_vector
+	{
+		public:
+			typedef	size_t							size_type;
+			typedef	Growth							growth_policy;
+			typedef	soaRow<soa_vector>				row;
+			typedef	soaConstRow<soa_vector>			const_row;
+
+		protected:
+			size_type					_c_size;
+			soaColumn<T0, Growth>		_c_col0;
+			soaColumn<T1, Growth>		_c_col1;
+			soaColumn<T2, Growth>		_c_col2;
+			soaColumn<T3, Growth>		_c_col3;
+			soaColumn<T4, Growth>		_c_col4;
+			soaColumn<T5, Growth>		_c_col5;
+
+			/**
+			 * Shrinks the first count columns back to size() rows, undoing a push_back or a resize
+			 * that threw after growing them. Shrinking does not throw.
+			 */
+			void	truncateColumns (size_type count)
+			{
+				if (count > 0)
+					this->_c_col0.resize(this->_c_size);
+				if (count > 1)
+					this->_c_col1.resize(this->_c_size);
+				if (count > 2)
+					this->_c_col2.resize(this->_c_size);
+				if (count > 3)
+					this->_c_col3.resize(this->_c_size);
+				if (count > 4)
+					this->_c_col4.resize(this->_c_size);
+			}
+
+		public:
+			/**
+			 * Type of field I, and access to its column.
+			 */
+			template <size_t I, class Dummy = void>
+			struct	field;
+
+			template <class Dummy>
+			struct	field<0, Dummy>
+			{
+				typedef T0	type;
+				static soaColumn<T0, Growth>		&of (soa_vector &v) { return (v._c_col0); }
+				static const soaColumn<T0, Growth>	&of (const soa_vector &v) { return (v._c_col0); }
+			};
+
+			template <class Dummy>
+			struct	field<1, Dummy>
+			{
+				typedef T1	type;
+				static soaColumn<T1, Growth>		&of (soa_vector &v) { return (v._c_col1); }
+				static const soaColumn<T1, Growth>	&of (const soa_vector &v) { return (v._c_col1); }
+			};
+
+			template <class Dummy>
+			struct	field<2, Dummy>
+			{
+				typedef T2	type;
+				static soaColumn<T2, Growth>		&of (soa_vector &v) { return (v._c_col2); }
+				static const soaColumn<T2, Growth>	&of (const soa_vector &v) { return (v._c_col2); }
+			};
+
+			template <class Dummy>
+			struct	field<3, Dummy>
+			{
+				typedef T3	type;
+				static soaColumn<T3, Growth>		&of (soa_vector &v) { return (v._c_col3); }
+				static const soaColumn<T3, Growth>	&of (const soa_vector &v) { return (v._c_col3); }
+			};
+
+			template <class Dummy>
+			struct	field<4, Dummy>
+			{
+				typedef T4	type;
+				static soaColumn<T4, Growth>		&of (soa_vector &v) { return (v._c_col4); }
+				static const soaColumn<T4, Growth>	&of (const soa_vector &v) { return (v._c_col4); }
+			};
+
+			template <class Dummy>
+			struct	field<5, Dummy>
+			{
+				typedef T5	type;
+				static soaColumn<T5, Growth>		&of (soa_vector &v) { return (v._c_col5); }
+				static const soaColumn<T5, Growth>	&of (const soa_vector &v) { return (v._c_col5); }
+			};
+
+		/**
+		 * Empty container constructor
+		 */
+		soa_vector (void): _c_size(0) {}
+
+		/**
+		 * Fill constructor: n rows of value-initialized fields.
+		 */
+		explicit	soa_vector (size_type n): _c_size(0)
+		{
+			resize(n);
+		}
+
+	//CAPACITY METHODS
+
+		size_type	size (void) const { return (this->_c_size); }
+		bool		empty (void) const { return (this->_c_size == 0); }
+		size_type	capacity (void) const { return (this->_c_col0.values.capacity()); }
+
+		/**
+		 * Request a change in capacity, for every column.
+		 *
+		 * @n : Minimum capacity, in rows.
+		 */
+		void reserve (size_type n)
+		{
+			this->_c_col0.reserve(n);
+			this->_c_col1.reserve(n);
+			this->_c_col2.reserve(n);
+			this->_c_col3.reserve(n);
+			this->_c_col4.reserve(n);
+			this->_c_col5.reserve(n);
+		}
+
+		/**
+		 * Change size. Added rows have value-initialized fields.
+		 *
+		 * Every column is reserved first, and if a field constructor throws the columns
+		 * already grown are shrunk back: the rows stay the same in every column.
+		 *
+		 * @n : New number of rows.
+		 */
+		void resize (size_type n)
+		{
+			size_type	done = 0;
+
+			reserve(n);
+			try
+			{
+				this->_c_col0.resize(n);
+				done++;
+				this->_c_col1.resize(n);
+				done++;
+				this->_c_col2.resize(n);
+				done++;
+				this->_c_col3.resize(n);
+				done++;
+				this->_c_col4.resize(n);
+				done++;
+				this->_c_col5.resize(n);
+			}
+			catch (...)
+			{
+				truncateColumns(done);
+				throw ;
+			}
+			this->_c_size = n;
+		}
+
+		void shrink_to_fit (void)
+		{
+			this->_c_col0.shrink_to_fit();
+			this->_c_col1.shrink_to_fit();
+			this->_c_col2.shrink_to_fit();
+			this->_c_col3.shrink_to_fit();
+			this->_c_col4.shrink_to_fit();
+			this->_c_col5.shrink_to_fit();
+		}
+
+		/**
+		 * Memory footprint: the bytes of storage held by all the columns.
+		 */
+		size_type memory_usage (void) const
+		{
+			return (this->_c_col0.memory_usage() + this->_c_col1.memory_usage() + this->_c_col2.memory_usage()
+				+ this->_c_col3.memory_usage() + this->_c_col4.memory_usage() + this->_c_col5.memory_usage());
+		}
+
+	//ELEMENT ACCESS METHODS
+
+		row			operator[] (size_type i) { return (row(*this, i)); }
+		const_row	operator[] (size_type i) const { return (const_row(*this, i)); }
+
+		/**
+		 * Field I of row i.
+		 */
+		template <size_t I>
+		typename field<I>::type	&get (size_type i) { return (field<I>::of(*this).values[i]); }
+
+		template <size_t I>
+		const typename field<I>::type	&get (size_type i) const { return (field<I>::of(*this).values[i]); }
+
+		/**
+		 * The contiguous array of field I, one value per row.
+		 */
+		template <size_t I>
+		soa_span<typename field<I>::type>	column (void)
+		{
+			return (soa_span<typename field<I>::type>(this->_c_size ? &field<I>::of(*this).values[0] : NULL, this->_c_size));
+		}
+
+		template <size_t I>
+		soa_span<const typename field<I>::type>	column (void) const
+		{
+			return (soa_span<const typename field<I>::type>(this->_c_size ? &field<I>::of(*this).values[0] : NULL, this->_c_size));
+		}
+
+	//MODIFIERS METHODS
+
+		/**
+		 * Add a row at the end.
+		 *
+		 * When the columns are full they all grow first, by the growth policy, so that no
+		 * allocation can fail halfway through the row. If a field copy throws, the fields
+		 * already added are removed: the rows stay the same in every column.
+		 *
+		 * @v0...v5 : the fields of the new row, one argument per field.
+		 */
+		void push_back (const T0 &v0, const T1 &v1 = T1(), const T2 &v2 = T2(), const T3 &v3 = T3(),
+			const T4 &v4 = T4(), const T5 &v5 = T5())
+		{
+			size_type	done = 0;
+
+			if (this->_c_size == capacity())
+				reserve(ft::growCapacity<Growth>(capacity(), this->_c_size + 1, this->_c_col0.values.max_size(), sizeof(T0)));
+			try
+			{
+				this->_c_col0.push_back(v0);
+				done++;
+				this->_c_col1.push_back(v1);
+				done++;
+				this->_c_col2.push_back(v2);
+				done++;
+				this->_c_col3.push_back(v3);
+				done++;
+				this->_c_col4.push_back(v4);
+				done++;
+				this->_c_col5.push_back(v5);
+			}
+			catch (...)
+			{
+				truncateColumns(done);
+				throw ;
+			}
+			this->_c_size++;
+		}
+
+		void pop_back (void)
+		{
+			this->_c_col0.pop_back();
+			this->_c_col1.pop_back();
+			this->_c_col2.pop_back();
+			this->_c_col3.pop_back();
+			this->_c_col4.pop_back();
+			this->_c_col5.pop_back();
+			this->_c_size--;
+		}
+
+		/**
+		 * Remove row pos, the following rows moving down by one.
+		 */
+		void erase (size_type pos)
+		{
+			this->_c_col0.erase(pos);
+			this->_c_col1.erase(pos);
+			this->_c_col2.erase(pos);
+			this->_c_col3.erase(pos);
+			this->_c_col4.erase(pos);
+			this->_c_col5.erase(pos);
+			this->_c_size--;
+		}
+
+		void clear (void)
+		{
+			this->_c_col0.clear();
+			this->_c_col1.clear();
+			this->_c_col2.clear();
+			this->_c_col3.clear();
+			this->_c_col4.clear();
+			this->_c_col5.clear();
+			this->_c_size = 0;
+		}
+
+		void swap (soa_vector &x)
+		{
+			size_type	tmp = x._c_size;
+
+			x._c_size = this->_c_size;
+			this->_c_size = tmp;
+			this->_c_col0.swap(x._c_col0);
+			this->_c_col1.swap(x._c_col1);
+			this->_c_col2.swap(x._c_col2);
+			this->_c_col3.swap(x._c_col3);
+			this->_c_col4.swap(x._c_col4);
+			this->_c_col5.swap(x._c_col5);
+		}
+	};
+
+	/**
+	 * Proxy standing for one row of an ft::soa_vector.
+	 */
+	template <class Soa>
+	class	soaRow
+	{
+		private:
+			Soa		*_r_soa;
+			size_t	_r_index;
+
+		public:
+			soaRow (Soa &soa, size_t index): _r_soa(&soa), _r_index(index) {}
+
+			size_t	index (void) const { return (this->_r_index); }
+
+			template <size_t I>
+			typename Soa::template field<I>::type	&get (void) const { return (this->_r_soa->template get<I>(this->_r_index)); }
+	};
+
+	template <class Soa>
+	class	soaConstRow
+	{
+		private:
+			const Soa	*_r_soa;
+			size_t		_r_index;
+
+		public:
+			soaConstRow (const Soa &soa, size_t index): _r_soa(&soa), _r_index(index) {}
+
+			size_t	index (void) const { return (this->_r_index); }
+
+			template <size_t I>
+			const typename Soa::template field<I>::type	&get (void) const { return (this->_r_soa->template get<I>(this->_r_index)); }
+	};
+
+	template < class T0, class T1, class T2, class T3, class T4, class T5, class Growth >
+	void	swap (soa_vector<T0, T1, T2, T3, T4, T5, Growth> &x, soa_vector<T0, T1, T2, T3, T4, T5, Growth> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -0,0 +1,374 @@
+#ifndef SORT_HPP
+# define SORT_HPP
+# include <cstddef>
+# include <cstring>
+# include <memory>
+# include "vector.hpp"
+
+/**
+ * Sorts of random access ranges (vectorIterator, pointers).
+ *
+ * ft::sort is an introsort: quicksort with a median of three pivot, switching to heapsort when
+ * the recursion gets deeper than twice the logarithm of the length, and leaving ranges of
+ * INSERTION_THRESHOLD elements or less to insertion sort. ft::stable_sort is a bottom-up merge sort.
+ * Both sort ranges of integers with their default order by an LSD radix sort instead, which is
+ * stable, when they hold RADIX_THRESHOLD elements or more.
+ */
+namespace	ft
+{
+	//ranges of this length or less are insertion sorted
+	static const size_t	INSERTION_THRESHOLD = 16;
+
+	//ranges of integers of this length or more are radix sorted
+	static const size_t	RADIX_THRESHOLD = 1024;
+
+	template <class RandomIterator>
+	void	iterSwap (RandomIterator a, RandomIterator b)
+	{
+		typename iteratorValue<RandomIterator>::type	tmp = FT_MOVE(*a);
+
+		*a = FT_MOVE(*b);
+		*b = FT_MOVE(tmp);
+	}
+
+	template <class RandomIterator, class Compare>
+	void	insertionSort (RandomIterator first, RandomIterator last, Compare comp)
+	{
+		RandomIterator	j;
+
+		if (first == last)
+			return ;
+		for (RandomIterator i = first + 1; i != last; ++i)
+		{
+			typename iteratorValue<RandomIterator>::type	val = FT_MOVE(*i);
+
+			for (j = i; j != first && comp(val, *(j - 1)); --j)
+				*j = FT_MOVE(*(j - 1));
+			*j = FT_MOVE(val);
+		}
+	}
+
+	/**
+	 * Restore the max-heap property of first[0, n) below the node hole.
+	 */
+	template <class RandomIterator, class Compare>
+	void	siftDown (RandomIterator first, size_t hole, size_t n, Compare comp)
+	{
+		size_t	child;
+
+		while ((child = 2 * hole + 1) < n)
+		{
+			if (child + 1 < n && comp(first[child], first[child + 1]))
+				child++;
+			if (!comp(first[hole], first[child]))
+				return ;
+			iterSwap(first + hole, first + child);
+			hole = child;
+		}
+	}
+
+	template <class RandomIterator, class Compare>
+	void	heapSort (RandomIterator first, RandomIterator last, Compare comp)
+	{
+		size_t	n = last - first;
+
+		for (size_t i = n / 2; i > 0; --i)
+			siftDown(first, i - 1, n, comp);
+		while (n > 1)
+		{
+			--n;
+			iterSwap(first, first + n);
+			siftDown(first, 0, n, comp);
+		}
+	}
+
+	/**
+	 * Move the median of a, b and c to first.
+	 */
+	template <class RandomIterator, class Compare>
+	void	medianToFirst (RandomIterator first, RandomIterator a, RandomIterator b, RandomIterator c, Compare comp)
+	{
+		if (comp(*a, *b))
+		{
+			if (comp(*b, *c))
+				iterSwap(first, b);
+			else if (comp(*a, *c))
+				iterSwap(first, c);
+			else
+				iterSwap(first, a);
+		}
+		else if (comp(*a, *c))
+			iterSwap(first, a);
+		else if (comp(*b, *c))
+			iterSwap(first, c);
+		else
+			iterSwap(first, b);
+	}
+
+	/**
+	 * Partition (first, last) around the pivot *first, which stays in place.
+	 *
+	 * The median of three leaves an element not less than the pivot and one not greater
+	 * than it on each side, so the scans need no bound check.
+	 *
+	 * @return : the first element of the upper part.
+	 */
+	template <class RandomIterator, class Compare>
+	RandomIterator	partitionPivot (RandomIterator first, RandomIterator last, Compare comp)
+	{
+		RandomIterator	lo = first + 1;
+		RandomIterator	hi = last;
+
+		medianToFirst(first, first + 1, first + (last - first) / 2, last - 1, comp);
+		for (;;)
+		{
+			while (comp(*lo, *first))
+				++lo;
+			--hi;
+			while (comp(*first, *hi))
+				--hi;
+			if (!(lo < hi))
+				return (lo);
+			iterSwap(lo, hi);
+			++lo;
+		}
+	}
+
+	template <class RandomIterator, class Compare>
+	void	introsortLoop (RandomIterator first, RandomIterator last, size_t depth, Compare comp)
+	{
+		RandomIterator	cut;
+
+		while (static_cast<size_t>(last - first) > INSERTION_THRESHOLD)
+		{
+			if (depth == 0)
+			{
+				heapSort(first, last, comp);
+				return ;
+			}
+			depth--;
+			cut = partitionPivot(first, last, comp);
+			//recursing on the smaller part bounds the stack to a logarithmic depth
+			if (cut - first < last - cut)
+			{
+				introsortLoop(first, cut, depth, comp);
+				first = cut;
+			}
+			else
+			{
+				introsortLoop(cut, last, depth, comp);
+				last = cut;
+			}
+		}
+		insertionSort(first, last, comp);
+	}
+
+	/**
+	 * Unsigned key of an integer, ordered as the integer is: the sign bit of signed types is flipped.
+	 * Only the sizeof(T) low bytes of the key are meaningful.
+	 */
+	template <class T>
+	unsigned long long	radixKey (const T &x)
+	{
+		unsigned long long	key = static_cast<unsigned long long>(x);
+
+		if (T(-1) < T(0))
+			key ^= 1ULL << (sizeof(T) * 8 - 1);
+		return (key);
+	}
+
+	/**
+	 * LSD radix sort of integers, one byte per pass.
+	 *
+	 * The counts of every pass are taken in a single read of the range, and the passes in which
+	 * every element has the same byte are skipped. Needs two buffers of last - first elements.
+	 */
+	template <class RandomIterator>
+	void	radixSort (RandomIterator first, RandomIterator last)
+	{
+		typedef typename iteratorValue<RandomIterator>::type	T;
+
+		size_t				n = last - first;
+		size_t				counts[sizeof(T)][256];
+		size_t				offset;
+		size_t				tmp;
+		std::allocator<T>	alloc;
+		T					*src;
+		T					*dst;
+		T					*swap;
+		size_t				i;
+
+		std::memset(counts, 0, sizeof(counts));
+		src = alloc.allocate(n);
+		dst = alloc.allocate(n);
+		i = 0;
+		for (RandomIterator it = first; it != last; ++it, ++i)
+		{
+			unsigned long long	key = radixKey(*it);
+
+			src[i] = *it;
+			for (size_t b = 0; b < sizeof(T); ++b)
+				counts[b][(key >> (8 * b)) & 0xFF]++;
+		}
+		for (size_t b = 0; b < sizeof(T); ++b)
+		{
+			if (counts[b][(radixKey(src[0]) >> (8 * b)) & 0xFF] == n)
+				continue ;
+			offset = 0;
+			for (size_t d = 0; d < 256; ++d)
+			{
+				tmp = counts[b][d];
+				counts[b][d] = offset;
+				offset += tmp;
+			}
+			for (i = 0; i < n; ++i)
+				dst[counts[b][(radixKey(src[i]) >> (8 * b)) & 0xFF]++] = src[i];
+			swap = src;
+			src = dst;
+			dst = swap;
+		}
+		for (i = 0; i < n; ++i)
+			first[i] = src[i];
+		alloc.deallocate(src, n);
+		alloc.deallocate(dst, n);
+	}
+
+	/**
+	 * Sort [first, last) with comp. Not stable: equivalent elements may be reordered.
+	 */
+	template <class RandomIterator, class Compare>
+	void	sort (RandomIterator first, RandomIterator last, Compare comp)
+	{
+		size_t	depth = 0;
+
+		for (size_t n = last - first; n > 1; n /= 2)
+			depth += 2;
+		introsortLoop(first, last, depth, comp);
+	}
+
+	/**
+	 * Default order of the sorts: operator<, or radix sort for integers.
+	 */
+	template <class T, bool Radix = is_integral<T>::value>
+	struct	sortDefault
+	{
+		bool	operator() (const T &a, const T &b) const { return (a < b); }
+
+		template <class RandomIterator>
+		static bool	radix (RandomIterator, RandomIterator) { return (false); }
+	};
+
+	template <class T>
+	struct	sortDefault<T, true>
+	{
+		bool	operator() (const T &a, const T &b) const { return (a < b); }
+
+		template <class RandomIterator>
+		static bool	radix (RandomIterator first, RandomIterator last)
+		{
+			if (static_cast<size_t>(last - first) < RADIX_THRESHOLD)
+				return (false);
+			radixSort(first, last);
+			return (true);
+		}
+	};
+
+	/**
+	 * Sort [first, last) with operator<.
+	 */
+	template <class RandomIterator>
+	void	sort (RandomIterator first, RandomIterator last)
+	{
+		typedef sortDefault<typename iteratorValue<RandomIterator>::type>	order;
+
+		if (!order::radix(first, last))
+			ft::sort(first, last, order());
+	}
+
+	/**
+	 * Stable merge of the runs of width elements of src[0, n) into dst[0, n), two by two.
+	 */
+	template <class Source, class Destination, class Compare>
+	void	mergeRuns (Source src, Destination dst, size_t n, size_t width, Compare comp)
+	{
+		size_t	mid;
+		size_t	hi;
+		size_t	i;
+		size_t	j;
+		size_t	k;
+
+		for (size_t lo = 0; lo < n; lo += 2 * width)
+		{
+			mid = lo + width < n ? lo + width : n;
+			hi = mid + width < n ? mid + width : n;
+			i = lo;
+			j = mid;
+			k = lo;
+			while (i < mid && j < hi)
+			{
+				if (comp(src[j], src[i]))
+					dst[k++] = src[j++];
+				else
+					dst[k++] = src[i++];
+			}
+			while (i < mid)
+				dst[k++] = src[i++];
+			while (j < hi)
+				dst[k++] = src[j++];
+		}
+	}
+
+	/**
+	 * Sort [first, last) with comp, equivalent elements keeping their order.
+	 *
+	 * Runs of INSERTION_THRESHOLD elements are insertion sorted, then merged two by two,
+	 * back and forth between the range and a buffer of last - first elements.
+	 */
+	template <class RandomIterator, class Compare>
+	void	stable_sort (RandomIterator first, RandomIterator last, Compare comp)
+	{
+		typedef typename iteratorValue<RandomIterator>::type	T;
+
+		size_t	n = last - first;
+		bool	inBuffer = false;
+
+		if (n <= INSERTION_THRESHOLD)
+		{
+			insertionSort(first, last, comp);
+			return ;
+		}
+		for (size_t lo = 0; lo < n; lo += INSERTION_THRESHOLD)
+			insertionSort(first + lo, lo + INSERTION_THRESHOLD < n ? first + lo + INSERTION_THRESHOLD : last, comp);
+
+		ft::vector<T>	buffer(first, last);
+		T				*tmp = &buffer[0];
+
+		for (size_t width = INSERTION_THRESHOLD; width < n; width *= 2)
+		{
+			if (inBuffer)
+				mergeRuns(tmp, first, n, width, comp);
+			else
+				mergeRuns(first, tmp, n, width, comp);
+			inBuffer = !inBuffer;
+		}
+		if (inBuffer)
+		{
+			for (size_t i = 0; i < n; ++i)
+				first[i] = FT_MOVE(tmp[i]);
+		}
+	}
+
+	/**
+	 * Stable sort of [first, last) with operator<.
+	 */
+	template <class RandomIterator>
+	void	stable_sort (RandomIterator first, RandomIterator last)
+	{
+		typedef sortDefault<typename iteratorValue<RandomIterator>::type>	order;
+
+		if (!order::radix(first, last))
+			ft::stable_sort(first, last, order());
+	}
+}
+
+#endif
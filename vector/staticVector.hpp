@@ -0,0 +1,485 @@
+#ifndef STATICVECTOR_HPP
+# define STATICVECTOR_HPP
+# include "vector.hpp"
+# include <cassert>
+# include <new>
+
+namespace ft
+{
+	/**
+	 * Overflow policies of ft::static_vector.
+	 *
+	 * A policy is a class with a static member bool overflow(const char *what), called when an
+	 * operation would need more than the capacity of the vector. The operation is then cancelled,
+	 * leaving the vector untouched, and the value returned by overflow() is reported to the caller.
+	 */
+	struct	overflow_throw
+	{
+		static bool	overflow(const char *what) { throw std::length_error(what); }
+	};
+
+	struct	overflow_assert
+	{
+		static bool	overflow(const char *what)
+		{
+			(void)what;
+			assert(!"static_vector: capacity exceeded");
+			return (false);
+		}
+	};
+
+	struct	overflow_return_false
+	{
+		static bool	overflow(const char *) { return (false); }
+	};
+
+	/**
+	 * Vector with a fixed capacity of N elements, stored inside the object.
+	 *
+	 * It never allocates: the storage is raw aligned bytes and an element is only
+	 * constructed when it is added. Operations that would go past N elements are
+	 * cancelled and reported through the Overflow policy.
+	 *
+	 * @N : the capacity.
+	 * @Overflow : overflow_throw (default), overflow_assert or overflow_return_false.
+	 */
+	template < class T, size_t N, class Overflow = ft::overflow_throw >
+	class	static_vector
+	{
+		public:
+			typedef	T										value_type;
+			typedef	T										&reference;
+			typedef	T	const								&const_reference;
+			typedef	T*										pointer;
+			typedef	T*	const								const_pointer;
+			typedef	vectorIterator<T>						iterator;
+			typedef	vectorConstIterator<T>					const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef	ptrdiff_t								difference_type;
+			typedef	size_t									size_type;
+			typedef	Overflow								overflow_policy;
+
+		protected:
+			size_type						_c_size;
+			ft::aligned_buffer<T, N>		_c_storage;
+
+		private:
+			//the shared storage helpers construct through an allocator: std::allocator only does placement new
+			typedef std::allocator<T>	element_allocator;
+
+			value_type			*data(void) { return (this->_c_storage.data()); }
+			const value_type	*data(void) const { return (this->_c_storage.data()); }
+
+			static void			construct(value_type *p, const value_type &val) { ::new (static_cast<void *>(p)) value_type(val); }
+			static void			destroy(value_type *p) { p->~value_type(); }
+
+			/**
+			 * Makes room for n uninitialized elements at index pos.
+			 *
+			 * @return : false, without touching anything, if n more elements do not fit.
+			 */
+			bool				openGap(size_type pos, size_type n, const char *what)
+			{
+				element_allocator	alloc;
+
+				if (n > N - this->_c_size)
+					return (Overflow::overflow(what));
+				ft::relocate(alloc, data() + pos + n, data() + pos, this->_c_size - pos);
+				this->_c_size += n;
+				return (true);
+			}
+
+			/**
+			 * Appends the elements of a single-pass range as they are read.
+			 *
+			 * @return : false, after destroying the elements it appended, if the range does not fit.
+			 */
+			template <class InputIterator>
+			bool				appendRange(InputIterator first, InputIterator last, const char *what)
+			{
+				size_type	old_size = this->_c_size;
+
+				for (; first != last; ++first)
+				{
+					if (this->_c_size == N)
+					{
+						while (this->_c_size > old_size)
+							destroy(data() + --this->_c_size);
+						return (Overflow::overflow(what));
+					}
+					construct(data() + this->_c_size, *first);
+					this->_c_size++;
+				}
+				return (true);
+			}
+
+			/**
+			 * Range assignment and insertion, dispatched on the iterator category: a forward range
+			 * is measured first, so that nothing changes if it does not fit. A single-pass range can
+			 * only be measured by reading it: it is appended as it comes, and removed if it overflows.
+			 */
+			template <class InputIterator>
+			bool				assignRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				clear();
+				return (appendRange(first, last, "static_vector::assign"));
+			}
+
+			template <class ForwardIterator>
+			bool				assignRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type			n = ft::rangeLength(first, last, typename ft::iterator_category<ForwardIterator>::type());
+				element_allocator	alloc;
+
+				if (n > N)
+					return (Overflow::overflow("static_vector::assign"));
+				clear();
+				ft::copyRange(alloc, data(), first, n);
+				this->_c_size = n;
+				return (true);
+			}
+
+			template <class InputIterator>
+			bool				insertRange(size_type pos, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				size_type	old_size = this->_c_size;
+
+				if (!appendRange(first, last, "static_vector::insert"))
+					return (false);
+				std::rotate(data() + pos, data() + old_size, data() + this->_c_size);
+				return (true);
+			}
+
+			template <class ForwardIterator>
+			bool				insertRange(size_type pos, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type			n = ft::rangeLength(first, last, typename ft::iterator_category<ForwardIterator>::type());
+				element_allocator	alloc;
+
+				if (!openGap(pos, n, "static_vector::insert"))
+					return (false);
+				ft::copyRange(alloc, data() + pos, first, n);
+				return (true);
+			}
+
+		public:
+
+		/**
+		 * Empty container constructor
+		 */
+		static_vector (void): _c_size(0) {}
+
+		/**
+		 * Fill constructor
+		 *
+		 * @param n : Initial container size
+		 * @param val : Value to fill the container with
+		 */
+		explicit	static_vector (size_type n, const value_type& val = value_type()): _c_size(0)
+		{
+			insert(end(), n, val);
+		}
+
+		/**
+		 * Range constructor.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a range.
+		 */
+		template <class InputIterator>
+		static_vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last): _c_size(0)
+		{
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @x : Another static_vector object of the same type.
+		 */
+		static_vector (const static_vector& x): _c_size(0)
+		{
+			insert(end(), x.begin(), x.end());
+		}
+
+		/**
+		 * Destructor of the container
+		 */
+		~static_vector (void)
+		{
+			clear();
+		}
+
+		static_vector& operator= (const static_vector& x)
+		{
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return (*this);
+		}
+
+	//ITERATORS
+
+		iterator				begin (void) { return (iterator(data())); }
+		const_iterator			begin (void) const { return (const_iterator(const_cast<value_type *>(data()))); }
+		iterator				end (void) { return (iterator(data() + this->_c_size)); }
+		const_iterator			end (void) const { return (const_iterator(const_cast<value_type *>(data()) + this->_c_size)); }
+		reverse_iterator		rbegin (void) { return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin (void) const { return (const_reverse_iterator(end())); }
+		reverse_iterator		rend (void) { return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend (void) const { return (const_reverse_iterator(begin())); }
+
+	//CAPACITY METHODS
+
+		size_type	size (void) const { return (this->_c_size); }
+		size_type	max_size (void) const { return (N); }
+		size_type	capacity (void) const { return (N); }
+		bool		empty (void) const { return (this->_c_size == 0); }
+		bool		full (void) const { return (this->_c_size == N); }
+
+		/**
+		 * Change size.
+		 *
+		 * @param n : New container size, expressed in number of elements.
+		 * @param val : Object whose content is copied to the added elements.
+		 * @return : false if n is greater than the capacity.
+		 */
+		bool resize (size_type n, value_type val = value_type())
+		{
+			if (n > N)
+				return (Overflow::overflow("static_vector::resize"));
+			if (n < this->_c_size)
+				erase(begin() + n, end());
+			else
+				insert(end(), n - this->_c_size, val);
+			return (true);
+		}
+
+		/**
+		 * Request a change in capacity.
+		 *
+		 * @n : Minimum capacity for the vector.
+		 * @return : false if n is greater than the capacity, which never changes.
+		 */
+		bool reserve (size_type n)
+		{
+			if (n > N)
+				return (Overflow::overflow("static_vector::reserve"));
+			return (true);
+		}
+
+	//ELEMENT ACCESS METHODS
+
+		reference		operator[] (size_type n) { return (data()[n]); }
+		const_reference	operator[] (size_type n) const { return (data()[n]); }
+
+		reference at (size_type n)
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("static_vector::at");
+			return (data()[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("static_vector::at");
+			return (data()[n]);
+		}
+
+		reference		front (void) { return (data()[0]); }
+		const_reference	front (void) const { return (data()[0]); }
+		reference		back (void) { return (data()[this->_c_size - 1]); }
+		const_reference	back (void) const { return (data()[this->_c_size - 1]); }
+
+	//MODIFIERS METHODS
+
+		/**
+		 * Assign : Fill version
+		 *
+		 * @param n : New size for the container
+		 * @param val : Value to fill the container with.
+		 * @return : false, leaving the content unchanged, if n is greater than the capacity.
+		 */
+		bool assign (size_type n, const value_type& val)
+		{
+			value_type	copy(val);
+
+			if (n > N)
+				return (Overflow::overflow("static_vector::assign"));
+			clear();
+			insert(end(), n, copy);
+			return (true);
+		}
+
+		/**
+		 * Assign : Range version.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a sequence.
+		 * @return : false if the range does not fit. The content is then unchanged for a forward range,
+		 * and empty for a single-pass range, which had to be read to be measured.
+		 */
+		template <class InputIterator>
+		bool assign (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			return (assignRange(first, last, typename ft::iterator_category<InputIterator>::type()));
+		}
+
+		/**
+		 * Add element at the end.
+		 *
+		 * @val : Value to be copied to the new element.
+		 * @return : false if the vector is full.
+		 */
+		bool push_back (const value_type& val)
+		{
+			if (this->_c_size == N)
+				return (Overflow::overflow("static_vector::push_back"));
+			construct(data() + this->_c_size, val);
+			this->_c_size++;
+			return (true);
+		}
+
+		/**
+		 * Delete last element.
+		 */
+		void pop_back (void)
+		{
+			if (this->_c_size > 0)
+				destroy(data() + --this->_c_size);
+		}
+
+		/**
+		 * Insert elements. (single element)
+		 *
+		 * @param position : Position in the vector where the new element is inserted.
+		 * @param val : Value to be copied to the inserted element.
+		 * @return : An iterator that points to the newly inserted element, or end() if the vector is full.
+		 */
+		iterator insert (iterator position, const value_type& val)
+		{
+			size_type	pos = position - begin();
+			value_type	copy(val);
+
+			if (!openGap(pos, 1, "static_vector::insert"))
+				return (end());
+			construct(data() + pos, copy);
+			return (begin() + pos);
+		}
+
+		/**
+		 * Insert elements. (fill)
+		 *
+		 * @position : Position in the vector where the new elements are inserted.
+		 * @n : Number of elements to insert.
+		 * @val : Value to be copied to the inserted elements.
+		 * @return : false, inserting nothing, if the elements do not fit.
+		 */
+		bool insert (iterator position, size_type n, const value_type& val)
+		{
+			size_type	pos = position - begin();
+			value_type	copy(val);
+
+			element_allocator	alloc;
+
+			if (!openGap(pos, n, "static_vector::insert"))
+				return (false);
+			ft::fillConstruct(alloc, data() + pos, n, copy);
+			return (true);
+		}
+
+		/**
+		 * Insert elements. (range)
+		 *
+		 * @position : Position in the vector where the new elements are inserted.
+		 * @first/@last : Iterators specifying a range of elements.
+		 * @return : false, inserting nothing, if the elements do not fit.
+		 */
+		template <class InputIterator>
+		bool insert (iterator position, InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			return (insertRange(position - begin(), first, last, typename ft::iterator_category<InputIterator>::type()));
+		}
+
+		/**
+		 * Erase elements.
+		 *
+		 * @position : Iterator pointing to a single element to be removed from the vector.
+		 * @return : An iterator pointing to the element that followed the erased one.
+		 */
+		iterator erase (iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		/**
+		 * Erase elements.
+		 *
+		 * @first/@last : Iterators specifying a range within the vector to be removed: [first,last).
+		 * @return : An iterator pointing to the element that followed the last erased one.
+		 */
+		iterator erase (iterator first, iterator last)
+		{
+			size_type			pos = first - begin();
+			size_type			n = last - first;
+			element_allocator	alloc;
+
+			ft::eraseGap(alloc, data(), this->_c_size, pos, n);
+			this->_c_size -= n;
+			return (begin() + pos);
+		}
+
+		/**
+		 * Swap content.
+		 *
+		 * The elements live inside the objects, so they are exchanged one by one.
+		 *
+		 * @x : Another static_vector of the same type.
+		 */
+		void swap (static_vector& x)
+		{
+			static_vector	tmp(*this);
+
+			*this = x;
+			x = tmp;
+		}
+
+		/**
+		 * Clear content.
+		 */
+		void clear (void)
+		{
+			erase(begin(), end());
+		}
+
+		/**
+		 * Relational operators for static_vector.
+		 */
+		bool operator== (const static_vector& rhs) const
+		{
+			return (ft::storageEqual(data(), this->_c_size, rhs.data(), rhs._c_size));
+		}
+
+		bool operator< (const static_vector& rhs) const
+		{
+			return (ft::storageLess(data(), this->_c_size, rhs.data(), rhs._c_size));
+		}
+
+		bool operator!= (const static_vector& rhs) const { return (!(*this == rhs)); }
+		bool operator<= (const static_vector& rhs) const { return (!(rhs < *this)); }
+		bool operator> (const static_vector& rhs) const { return (rhs < *this); }
+		bool operator>= (const static_vector& rhs) const { return (!(*this < rhs)); }
+	};
+
+	/**
+	 * Exchanges contents of static_vectors.
+	 *
+	 * @x/@y : static_vector containers of the same type.
+	 */
+	template<class T, size_t N, class Overflow>
+	void swap (static_vector<T,N,Overflow>& x, static_vector<T,N,Overflow>& y)
+	{
+		x.swap(y);
+	}
+};
+
+#endif
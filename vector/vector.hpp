@@ -2,7 +2,12 @@
 # define VECTOR_HPP
 # include "vectorIterators.hpp"
 # include "../utils.hpp"
+# include "growthPolicy.hpp"
+# include "simd.hpp"
+# include "vectorStorage.hpp"
+# include <algorithm>
 # include <cstddef>
+# include <cstring>
 # include <stdexcept>
 # include <sstream>
 
@@ -11,7 +16,30 @@
  */
 namespace ft
 {
-	template < class T, class Alloc = std::allocator<T> >
+	/**
+	 * Calls Alloc::reallocate() for the allocators that have one (see ft::can_reallocate).
+	 */
+	template <class Alloc, bool = ft::can_reallocate<Alloc>::value>
+	struct	reallocator
+	{
+		static typename Alloc::pointer	reallocate(Alloc &, typename Alloc::pointer, size_t, size_t) { return (NULL); }
+	};
+
+	template <class Alloc>
+	struct	reallocator<Alloc, true>
+	{
+		static typename Alloc::pointer	reallocate(Alloc &alloc, typename Alloc::pointer p, size_t old_n, size_t new_n)
+		{
+			return (alloc.reallocate(p, old_n, new_n));
+		}
+	};
+
+	/**
+	 * Vectors are sequence containers representing arrays that can change in size.
+	 *
+	 * @Growth : the growth policy deciding the new capacity when the vector is full (see growthPolicy.hpp).
+	 */
+	template < class T, class Alloc = std::allocator<T>, class Growth = ft::grow_double >
 	class	vector
 	{
 		public:
@@ -27,6 +55,7 @@ namespace ft
 			typedef	ft::reverse_iterator<const_iterator>		const_reverse_iterator;
 			typedef	ptrdiff_t								difference_type;
 			typedef	size_t									size_type;
+			typedef	Growth									growth_policy;
 
 		protected:
 			value_type		*_c_container;
@@ -37,26 +66,160 @@ namespace ft
 		private:
 			size_t			more_capacity(size_t new1)
 			{
-				size_type	new2 = this->_c_size > 0 ? this->_c_size * 2 : 1;
-
-				return (new1 > new2 ? new1 : new2);
+				return (ft::growCapacity<Growth>(this->_c_capacity, new1, max_size(), sizeof(value_type)));
 			}
 
 			void			realloc(size_type new_capacity)
 			{
 				value_type	*tmp;
 
+				//let the allocator resize the block in place when the elements can be moved bytewise
+				if (ft::is_trivially_relocatable<value_type>::value && this->_c_capacity > 0)
+				{
+					tmp = reallocator<allocator_type>::reallocate(this->_c_allocator, this->_c_container, this->_c_capacity, new_capacity);
+					if (tmp != NULL)
+					{
+						this->_c_container = tmp;
+						this->_c_capacity = new_capacity;
+						return ;
+					}
+				}
 				tmp = this->_c_allocator.allocate(new_capacity);
-				for (size_type i = 0; i < this->_c_size; i++)
-					this->_c_allocator.construct(tmp + i, this->_c_container[i]);
-				for (size_type j = 0; j < this->_c_size; j++)
-					this->_c_allocator.destroy(this->_c_container + j);
+				try
+				{
+					ft::relocate(this->_c_allocator, tmp, this->_c_container, this->_c_size);
+				}
+				catch (...)
+				{
+					this->_c_allocator.deallocate(tmp, new_capacity);
+					throw ;
+				}
 				if (this->_c_capacity > 0)
 					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
 				this->_c_container = tmp;
 				this->_c_capacity = new_capacity;
 			}
 
+			/**
+			 * Replaces the content with a range that can only be read once:
+			 * the elements are appended as they come, with geometric growth.
+			 */
+			template <class InputIterator>
+			void			assignRange(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				clear();
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			/**
+			 * Replaces the content with a forward range: its length is known first,
+			 * so the storage grows at most once and the elements are copied in bulk.
+			 */
+			template <class ForwardIterator>
+			void			assignRange(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = ft::rangeLength(first, last, typename ft::iterator_category<ForwardIterator>::type());
+
+				clear();
+				reserve(n);
+				ft::copyRange(this->_c_allocator, this->_c_container, first, n);
+				this->_c_size = n;
+			}
+
+			/**
+			 * Inserts a range that can only be read once: the elements are appended
+			 * at the end as they come, then rotated into place.
+			 */
+			template <class InputIterator>
+			void			insertRange(size_type pos, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				size_type	old_size = this->_c_size;
+
+				for (; first != last; ++first)
+					push_back(*first);
+				std::rotate(this->_c_container + pos, this->_c_container + old_size, this->_c_container + this->_c_size);
+			}
+
+			template <class ForwardIterator>
+			void			insertRange(size_type pos, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = ft::rangeLength(first, last, typename ft::iterator_category<ForwardIterator>::type());
+
+				insertFill(pos, n, ft::rangeFill<ForwardIterator>(first));
+			}
+
+			/**
+			 * Inserts at index pos n elements built by fill (see ft::rangeFill). If fill or a
+			 * copy throws, the vector is left as it was.
+			 *
+			 * When the elements can be moved without throwing, those from pos to the end are moved
+			 * up by n in a single pass, the storage growing once if needed, and moved back if fill
+			 * throws. Otherwise the new elements and copies of the old ones are built in a new
+			 * storage, which only replaces the old one once every element is built.
+			 */
+			template <class Fill>
+			void			insertFill(size_type pos, size_type n, const Fill &fill)
+			{
+				value_type	*tmp;
+				size_type	new_capacity;
+
+				if (n == 0)
+					return ;
+				if (ft::relocatesNothrow<value_type>::value)
+				{
+					if (this->_c_size + n > this->_c_capacity)
+						realloc(more_capacity(this->_c_size + n));
+					ft::relocate(this->_c_allocator, this->_c_container + pos + n, this->_c_container + pos, this->_c_size - pos);
+					try
+					{
+						fill(this->_c_allocator, this->_c_container + pos, n);
+					}
+					catch (...)
+					{
+						ft::relocate(this->_c_allocator, this->_c_container + pos, this->_c_container + pos + n, this->_c_size - pos);
+						throw ;
+					}
+					this->_c_size += n;
+					return ;
+				}
+				new_capacity = this->_c_size + n > this->_c_capacity ? more_capacity(this->_c_size + n) : this->_c_capacity;
+				tmp = this->_c_allocator.allocate(new_capacity);
+				try
+				{
+					fill(this->_c_allocator, tmp + pos, n);
+					try
+					{
+						ft::copyConstruct(this->_c_allocator, tmp, this->_c_container, pos);
+						try
+						{
+							ft::copyConstruct(this->_c_allocator, tmp + pos + n, this->_c_container + pos, this->_c_size - pos);
+						}
+						catch (...)
+						{
+							ft::destroyRange(this->_c_allocator, tmp, pos);
+							throw ;
+						}
+					}
+					catch (...)
+					{
+						ft::destroyRange(this->_c_allocator, tmp + pos, n);
+						throw ;
+					}
+				}
+				catch (...)
+				{
+					this->_c_allocator.deallocate(tmp, new_capacity);
+					throw ;
+				}
+				ft::destroyRange(this->_c_allocator, this->_c_container, this->_c_size);
+				if (this->_c_capacity > 0)
+					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = tmp;
+				this->_c_capacity = new_capacity;
+				this->_c_size += n;
+			}
+
 		public:
 
 		/**
@@ -81,12 +244,23 @@ namespace ft
 		 * @param val : Value to fill the container with
 		 * @param alloc : Allocator object
 		 */
-		explicit	vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		explicit	vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()):
+			_c_container(NULL), _c_allocator(alloc), _c_size(0), _c_capacity(0)
 		{
+			if (n == 0)
+				return ;
 			this->_c_container = (this->_c_allocator).allocate(static_cast<size_type>(n));
-            		for (this->_c_capacity = 0; this->_c_capacity < n; this->_c_capacity++)
-                		(this->_c_allocator).construct(&this->_c_container[this->_c_capacity], val);
-            		this->_c_size = this->_c_capacity;
+			this->_c_capacity = n;
+			try
+			{
+				ft::fillConstruct(this->_c_allocator, this->_c_container, n, val);
+			}
+			catch (...)
+			{
+				this->_c_allocator.deallocate(this->_c_container, n);
+				throw ;
+			}
+			this->_c_size = n;
 		}
 
 		/**
@@ -99,41 +273,54 @@ namespace ft
 		 * @alloc : Allocator object.
 		 */
 		template <class InputIterator>
-		vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last, const allocator_type& alloc = allocator_type()): _c_allocator(alloc)
+		vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last, const allocator_type& alloc = allocator_type()):
+			_c_container(NULL), _c_allocator(alloc), _c_size(0), _c_capacity(0)
 		{
-			InputIterator copy_first = first;
-            		size_t          i;
-
-            		this->_c_allocator = alloc;
-            		for(this->_c_capacity = 0; first != last; first++)
-            		    this->_c_capacity++;
-            		this->_c_container = (this->_c_allocator).allocate(static_cast<size_t>(this->_c_capacity));
-
-            		first = copy_first;
-            		for(i = 0; first != last; i++)
-            		    (this->_c_allocator).construct(&this->_c_container[i], *first++);
-            		this->_c_size = this->_c_capacity;
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
 		}
 
 		/**
 		 * Copy constructor.
 		 *
 		 * Constructs a container with a copy of each of the elements in x, in the same order.
+		 * The storage is allocated once, exactly for the size of x, and filled in a single pass.
 		 *
 		 * @x : Another vector object of the same type (with the same class template
 		 * arguments T and Alloc), whose contents are either copied or acquired.
 		 */
-		vector (const vector& x)
+		vector (const vector& x): _c_container(NULL), _c_allocator(x._c_allocator), _c_size(0), _c_capacity(0)
 		{
-			size_type i;
+			if (x._c_size == 0)
+				return ;
+			this->_c_container = this->_c_allocator.allocate(x._c_size);
+			this->_c_capacity = x._c_size;
+			try
+			{
+				ft::copyConstruct(this->_c_allocator, this->_c_container, x._c_container, x._c_size);
+			}
+			catch (...)
+			{
+				this->_c_allocator.deallocate(this->_c_container, x._c_size);
+				throw ;
+			}
+			this->_c_size = x._c_size;
+		}
 
-            		this->_c_capacity = x._c_size;
-            		this->_c_allocator = allocator_type();
-            		this->_c_size = 0;
-            		this->_c_container = (this->_c_allocator).allocate(static_cast<size_type>(this->_c_capacity));
-            		for (i = 0; i < x._c_size; i++)
-            		    this->push_back(x._c_container[i]);
+# if FT_CXX11
+		/**
+		 * Move constructor.
+		 *
+		 * Takes the storage of x, which is left empty.
+		 *
+		 * @x : Another vector object of the same type.
+		 */
+		vector (vector&& x) noexcept: _c_container(x._c_container), _c_allocator(FT_MOVE(x._c_allocator)), _c_size(x._c_size), _c_capacity(x._c_capacity)
+		{
+			x._c_container = NULL;
+			x._c_size = 0;
+			x._c_capacity = 0;
 		}
+# endif
 
 		/**
 		 * Destructor of the container
@@ -141,16 +328,87 @@ namespace ft
 		~vector (void)
 		{
 			clear();
-			//this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+			if (this->_c_capacity > 0)
+				this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
 		}
 
+		/**
+		 * Copy assignment.
+		 *
+		 * The current storage is reused when it can hold the elements of x: they are assigned
+		 * over the existing elements (a single memcpy for trivially copyable types), and the
+		 * remaining ones are constructed or destroyed. Otherwise a new storage of exactly
+		 * x.size() elements is allocated once and filled before the old one is released.
+		 *
+		 * @x : A vector object of the same type.
+		 * @return : *this.
+		 */
 		vector& operator= (const vector& x)
 		{
-			this->_c_container = x._c_container;
-			this->_c_size = x.size();
+			value_type	*tmp;
+			size_type	common;
+
+			if (this == &x)
+				return (*this);
+			if (x._c_size > this->_c_capacity)
+			{
+				tmp = this->_c_allocator.allocate(x._c_size);
+				try
+				{
+					ft::copyConstruct(this->_c_allocator, tmp, x._c_container, x._c_size);
+				}
+				catch (...)
+				{
+					this->_c_allocator.deallocate(tmp, x._c_size);
+					throw ;
+				}
+				clear();
+				if (this->_c_capacity > 0)
+					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = tmp;
+				this->_c_capacity = x._c_size;
+			}
+			else if (ft::is_trivially_copyable<value_type>::value)
+			{
+				if (x._c_size > 0)
+					std::memcpy(static_cast<void *>(this->_c_container), static_cast<const void *>(x._c_container), x._c_size * sizeof(value_type));
+			}
+			else
+			{
+				common = this->_c_size < x._c_size ? this->_c_size : x._c_size;
+				for (size_type i = 0; i < common; i++)
+					this->_c_container[i] = x._c_container[i];
+				if (x._c_size > this->_c_size)
+					ft::copyConstruct(this->_c_allocator, this->_c_container + common, x._c_container + common, x._c_size - common);
+				else
+					erase(begin() + common, end());
+			}
+			this->_c_size = x._c_size;
 			return (*this);
 		}
 
+# if FT_CXX11
+		/**
+		 * Move assignment: releases the elements and storage of the vector, then takes those of x.
+		 */
+		vector& operator= (vector&& x) noexcept
+		{
+			if (this != &x)
+			{
+				clear();
+				if (this->_c_capacity > 0)
+					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = x._c_container;
+				this->_c_size = x._c_size;
+				this->_c_capacity = x._c_capacity;
+				x._c_container = NULL;
+				x._c_size = 0;
+				x._c_capacity = 0;
+			}
+			return (*this);
+		}
+# endif
+
 	//ITERATORS
 
 		/**
@@ -272,14 +530,52 @@ namespace ft
 		 */
 		void resize (size_type n, value_type val = value_type())
 		{
-			if (n > this->_c_capacity)
-				realloc(more_capacity(n));
 			if (n < this->_c_size)
-				while (this->_c_size > n)
-					pop_back();
+				erase(begin() + n, end());
 			else if (n > this->_c_size)
-				while (this->_c_size < n)
-					push_back(val);
+			{
+				if (n > this->_c_capacity)
+					realloc(more_capacity(n));
+				ft::fillConstruct(this->_c_allocator, this->_c_container + this->_c_size, n - this->_c_size, val);
+				this->_c_size = n;
+			}
+		}
+
+		/**
+		 * Change size, leaving the new elements default-initialized.
+		 *
+		 * For trivially default constructible types (see ft::is_trivially_default_constructible),
+		 * the new elements are not initialized at all: their storage is left as the allocator gave it,
+		 * ready to be filled by read() or a decoder. Other types are value-initialized as by resize(n).
+		 *
+		 * @param n : New container size, expressed in number of elements.
+		 */
+		void resize_default_init (size_type n)
+		{
+			if (!ft::is_trivially_default_constructible<value_type>::value || n <= this->_c_size)
+				resize(n);
+			else
+			{
+				if (n > this->_c_capacity)
+					realloc(more_capacity(n));
+				this->_c_size = n;
+			}
+		}
+
+		/**
+		 * Change size, leaving the new elements uninitialized.
+		 *
+		 * Same as resize_default_init(), but only compiles for trivially default constructible types,
+		 * so that it never initializes anything.
+		 *
+		 * @param n : New container size, expressed in number of elements.
+		 */
+		void resize_uninitialized (size_type n)
+		{
+			typedef char	requires_trivial_type[ft::is_trivially_default_constructible<value_type>::value ? 1 : -1];
+
+			(void)sizeof(requires_trivial_type);
+			resize_default_init(n);
 		}
 
 		/**
@@ -323,6 +619,54 @@ namespace ft
 				realloc(n);
 		}
 
+		/**
+		 * Request an exact capacity.
+		 *
+		 * Unlike reserve(), the capacity becomes exactly n, or size() if n is smaller,
+		 * so the storage can shrink as well as grow. An empty vector with no capacity
+		 * holds no storage at all.
+		 *
+		 * @n : New capacity for the vector.
+		 */
+		void reserve_exact (size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("vector::reserve_exact");
+			if (n < this->_c_size)
+				n = this->_c_size;
+			if (n == this->_c_capacity)
+				return ;
+			if (n > 0)
+				realloc(n);
+			else
+			{
+				this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = NULL;
+				this->_c_capacity = 0;
+			}
+		}
+
+		/**
+		 * Shrink to fit.
+		 *
+		 * Reduces the capacity to the size, giving the unused storage back to the allocator.
+		 */
+		void shrink_to_fit (void)
+		{
+			reserve_exact(this->_c_size);
+		}
+
+		/**
+		 * Memory footprint.
+		 *
+		 * @return : the number of bytes of storage held by the vector, used or not
+		 * (capacity() elements). The object itself and the memory owned by the elements are not counted.
+		 */
+		size_type memory_usage (void) const
+		{
+			return (this->_c_capacity * sizeof(value_type));
+		}
+
 	//ELEMENT ACCESS METHODS
 
 		/**
@@ -437,6 +781,69 @@ namespace ft
 		}
 
 
+	//SEARCH METHODS
+
+		/**
+		 * Find element.
+		 *
+		 * For arithmetic types, the elements are compared several at a time with SIMD
+		 * instructions (see simd.hpp).
+		 *
+		 * @val : Value to search for.
+		 * @return : An iterator to the first element equal to val, or end().
+		 */
+		iterator find (const value_type& val)
+		{
+			return (begin() + ft::simd::find(this->_c_container, this->_c_size, val));
+		}
+
+		const_iterator find (const value_type& val) const
+		{
+			return (begin() + ft::simd::find(this->_c_container, this->_c_size, val));
+		}
+
+		/**
+		 * Count elements.
+		 *
+		 * @val : Value to count.
+		 * @return : The number of elements equal to val.
+		 */
+		size_type count (const value_type& val) const
+		{
+			return (ft::simd::count(this->_c_container, this->_c_size, val));
+		}
+
+		/**
+		 * Test whether an element is in the vector.
+		 *
+		 * @val : Value to search for.
+		 * @return : true if an element is equal to val.
+		 */
+		bool contains (const value_type& val) const
+		{
+			return (ft::simd::find(this->_c_container, this->_c_size, val) != this->_c_size);
+		}
+
+		/**
+		 * Return the least element. The vector must not be empty.
+		 *
+		 * @return : A reference to the first element that no other element is less than.
+		 */
+		const_reference min (void) const
+		{
+			return (this->_c_container[ft::simd::min_index(this->_c_container, this->_c_size)]);
+		}
+
+		/**
+		 * Return the greatest element. The vector must not be empty.
+		 *
+		 * @return : A reference to the first element that is not less than any other element.
+		 */
+		const_reference max (void) const
+		{
+			return (this->_c_container[ft::simd::max_index(this->_c_container, this->_c_size)]);
+		}
+
 	//MODIFIERS METHODS
 		
 		/**
@@ -452,10 +859,12 @@ namespace ft
 		 */
 		void assign (size_type n, const value_type& val)
 		{
+			value_type	copy(val);
+
 			clear();
 			reserve(n);
-			for (size_type j = 0; j < n; ++j)
-				push_back(val);
+			ft::fillConstruct(this->_c_allocator, this->_c_container, n, copy);
+			this->_c_size = n;
 		}
 
 		/**
@@ -471,17 +880,7 @@ namespace ft
 		template <class InputIterator>
 		void assign (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
 		{
-			int		i = 0;
-
-			for (InputIterator tmp = first; tmp != last; tmp++)
-				i++;
-			clear();
-			reserve(i);
-			while (first != last)
-			{
-				push_back(*first);
-				first++;
-			}
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
 		}
 
 		/**
@@ -494,11 +893,39 @@ namespace ft
 		void push_back (const value_type& val)
 		{
 			if (this->_c_size >= this->_c_capacity)
-				realloc(more_capacity(this->_c_capacity + 1));
+				realloc(more_capacity(this->_c_size + 1));
 			this->_c_allocator.construct(this->_c_container + this->_c_size, val);
 			this->_c_size++;
 		}
 
+# if FT_CXX11
+		void push_back (value_type&& val)
+		{
+			emplace_back(FT_MOVE(val));
+		}
+
+		/**
+		 * Construct and insert element at the end.
+		 *
+		 * @args : Arguments forwarded to the constructor of the new element.
+		 */
+		template <class... Args>
+		void emplace_back (Args&&... args)
+		{
+			if (this->_c_size < this->_c_capacity)
+				this->_c_allocator.construct(this->_c_container + this->_c_size, std::forward<Args>(args)...);
+			else
+			{
+				//args may refer to an element, build the value before the storage moves
+				value_type	tmp(std::forward<Args>(args)...);
+
+				realloc(more_capacity(this->_c_size + 1));
+				this->_c_allocator.construct(this->_c_container + this->_c_size, FT_MOVE(tmp));
+			}
+			this->_c_size++;
+		}
+# endif
+
 		/**
 		 * Delete last element.
 		 *
@@ -522,23 +949,36 @@ namespace ft
 		 */
 		iterator insert (iterator position, const value_type& val)
 		{
-			size_type	pos = 0;
-			size_type	end = this->_c_size;
+			size_type	pos = position - begin();
+			value_type	copy(val);
 
-			for (iterator it = begin(); it != position; it++)
-				pos++;
-			if (this->_c_size <= this->_c_capacity)
-				realloc(this->_c_capacity + 1);
-			while (end > pos)
-			{
-				this->_c_allocator.destroy(&this->_c_container[end]);
-				this->_c_allocator.construct(&this->_c_container[end], this->_c_container[end - 1]);
-				end--;
-			}
-			this->_c_size++;
-			this->_c_allocator.construct(&this->_c_container[end], val);
-			return (begin() + end);
+			insertFill(pos, 1, ft::valueFill<value_type>(copy));
+			return (begin() + pos);
+		}
+
+# if FT_CXX11
+		iterator insert (iterator position, value_type&& val)
+		{
+			return (emplace(position, FT_MOVE(val)));
+		}
+
+		/**
+		 * Construct and insert element.
+		 *
+		 * @position : Position in the vector where the new element is inserted.
+		 * @args : Arguments forwarded to the constructor of the new element.
+		 * @return : An iterator that points to the new element.
+		 */
+		template <class... Args>
+		iterator emplace (iterator position, Args&&... args)
+		{
+			size_type	pos = position - begin();
+			value_type	tmp(std::forward<Args>(args)...);
+
+			insertFill(pos, 1, ft::moveFill<value_type>(tmp));
+			return (begin() + pos);
 		}
+# endif
 
 		/**
 		 * Insert elements. (fill)
@@ -552,8 +992,10 @@ namespace ft
 		 */
 		void insert (iterator position, size_type n, const value_type& val)
 		{
-			while (n--)
-				position = insert(position, val);
+			size_type	pos = position - begin();
+			value_type	copy(val);
+
+			insertFill(pos, n, ft::valueFill<value_type>(copy));
 		}
 
 		/**
@@ -569,11 +1011,7 @@ namespace ft
 		template <class InputIterator>
    		void insert (iterator position, InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
 		{
-			while (first != last)
-			{
-				position = insert(position, *first++);
-				position++;
-			}
+			insertRange(position - begin(), first, last, typename ft::iterator_category<InputIterator>::type());
 		}
 
 		/**
@@ -587,14 +1025,7 @@ namespace ft
 		 */
 		iterator erase (iterator position)
 		{
-			iterator	ret(position);
-			iterator	save_end(end());
-
-			while (position + 1 != save_end)
-				*position++ = *(position + 1);
-			this->_c_allocator.destroy(&*position);
-			--this->_c_size;
-			return (ret);
+			return (erase(position, position + 1));
 		}
 
 		/**
@@ -608,17 +1039,12 @@ namespace ft
 		 */
 		iterator erase (iterator first, iterator last)
 		{
-			iterator	ret(first);
-			iterator	save_end(end());
+			size_type	pos = first - begin();
+			size_type	n = last - first;
 
-			while (last < save_end)
-				*first++ = *last++;
-			while (first < save_end)
-			{
-				this->_c_allocator.destroy(&*(first++));
-				this->_c_size--;
-			}
-			return (ret);
+			ft::eraseGap(this->_c_allocator, this->_c_container, this->_c_size, pos, n);
+			this->_c_size -= n;
+			return (begin() + pos);
 		}
 
 		/**
@@ -660,70 +1086,34 @@ namespace ft
 		 *
 		 * Performs the appropriate comparison operation between the vector containers lhs and rhs.
 		 */
-		bool operator== (const vector<T,Alloc>& rhs)
+		bool operator== (const vector& rhs) const
 		{
-			if (this->_c_size != rhs.size())
-				return (false);
-
-			iterator	it1 = begin();
-			iterator	it2 = rhs.begin();
-			while (it1 != end() || it2 != rhs.end())
-			{
-				if (*it1 != *it2)
-					return (false);
-				it1++;
-				it2++;
-			}
-			return (true);
+			return (ft::storageEqual(this->_c_container, this->_c_size, rhs._c_container, rhs._c_size));
 		}
 
-		bool operator!= (const vector<T,Alloc>& rhs)
+		bool operator!= (const vector& rhs) const
 		{
 			return (!(*this == rhs));
 		}
 
-		bool operator< (const vector<T,Alloc>& rhs)
+		bool operator< (const vector& rhs) const
 		{
-			const_iterator it_this(this->begin());
-            		const_iterator last(end());
-            		const_iterator it_rhs(rhs.begin());
-            		const_iterator last_rhs(rhs.end());
-
-            		while(it_this != last && it_rhs != last_rhs)
-            		{
-            		    if (*it_this < *it_rhs)
-            		        return (1);
-            		    else if (*it_rhs++ < *it_this++)
-            		        return (0);
-            		}
-            		return (this->size() < rhs.size());
+			return (ft::storageLess(this->_c_container, this->_c_size, rhs._c_container, rhs._c_size));
 		}
 
-		bool operator<= (const vector<T,Alloc>& rhs)
+		bool operator<= (const vector& rhs) const
 		{
-			return ((*this < rhs) || (*this == rhs));
+			return (!(rhs < *this));
 		}
 
-		bool operator> (const vector<T,Alloc>& rhs)
+		bool operator> (const vector& rhs) const
 		{
-			const_iterator it_this(this->begin());
-            		const_iterator last(end());
-            		const_iterator it_rhs(rhs.begin());
-            		const_iterator last_rhs(rhs.end());
-
-            		while(it_this != last && it_rhs != last_rhs)
-            		{
-            		    if (*it_this > *it_rhs)
-            		        return (1);
-            		    else if (*it_rhs++ > *it_this++)
-            		        return (0);
-            		}
-            		return (this->size() > rhs.size());
+			return (rhs < *this);
 		}
 
-		bool operator>= (const vector<T,Alloc>& rhs)
+		bool operator>= (const vector& rhs) const
 		{
-			return ((*this > rhs) || (*this == rhs));
+			return (!(*this < rhs));
 		}
 
 	};
@@ -734,11 +1124,13 @@ namespace ft
 	 * The contents of container x are exchanged with those of y.
 	 * @x/@y : vector containers of the same type.
 	 */
-	template<class T, class Alloc>
-	void swap (vector<T,Alloc>& x, vector<T,Alloc>& y)
+	template<class T, class Alloc, class Growth>
+	void swap (vector<T,Alloc,Growth>& x, vector<T,Alloc,Growth>& y)
 	{
 		x.swap(y);
 	}
 };
 
+# include "vectorBool.hpp"
+
 #endif
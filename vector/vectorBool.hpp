@@ -0,0 +1,757 @@
+#ifndef VECTORBOOL_HPP
+# define VECTORBOOL_HPP
+# include "vector.hpp"
+# include <climits>
+
+namespace	ft
+{
+	/**
+	 * Storage unit of ft::vector<bool>: element i is bit i % BIT_WORD of word i / BIT_WORD.
+	 */
+	typedef unsigned long	bit_word;
+	static const size_t		BIT_WORD = sizeof(bit_word) * CHAR_BIT;
+
+	/**
+	 * Proxy standing for one element of ft::vector<bool>.
+	 */
+	class	bitReference
+	{
+		private:
+			bit_word	*_r_word;
+			bit_word	_r_mask;
+
+		public:
+			bitReference (bit_word *word, bit_word mask): _r_word(word), _r_mask(mask) {}
+
+			operator bool (void) const { return ((*this->_r_word & this->_r_mask) != 0); }
+			bool	operator~ (void) const { return ((*this->_r_word & this->_r_mask) == 0); }
+
+			bitReference	&operator= (bool x)
+			{
+				if (x)
+					*this->_r_word |= this->_r_mask;
+				else
+					*this->_r_word &= ~this->_r_mask;
+				return (*this);
+			}
+
+			bitReference	&operator= (const bitReference &x) { return (*this = static_cast<bool>(x)); }
+
+			void	flip (void) { *this->_r_word ^= this->_r_mask; }
+	};
+
+	/**
+	 * Position of a bit, shared by the iterators of ft::vector<bool>.
+	 */
+	class	bitIteratorBase
+	{
+		protected:
+			bit_word		*_i_word;
+			unsigned int	_i_offset;
+
+			bitIteratorBase (bit_word *word, unsigned int offset): _i_word(word), _i_offset(offset) {}
+
+			void	increment (void)
+			{
+				if (++this->_i_offset == BIT_WORD)
+				{
+					this->_i_offset = 0;
+					++this->_i_word;
+				}
+			}
+
+			void	decrement (void)
+			{
+				if (this->_i_offset-- == 0)
+				{
+					this->_i_offset = BIT_WORD - 1;
+					--this->_i_word;
+				}
+			}
+
+			void	advance (std::ptrdiff_t n)
+			{
+				std::ptrdiff_t	bits = n + this->_i_offset;
+				std::ptrdiff_t	words = bits / static_cast<std::ptrdiff_t>(BIT_WORD);
+
+				bits %= static_cast<std::ptrdiff_t>(BIT_WORD);
+				if (bits < 0)
+				{
+					bits += BIT_WORD;
+					words--;
+				}
+				this->_i_word += words;
+				this->_i_offset = static_cast<unsigned int>(bits);
+			}
+
+		public:
+			std::ptrdiff_t	operator- (const bitIteratorBase &x) const
+			{
+				return ((this->_i_word - x._i_word) * static_cast<std::ptrdiff_t>(BIT_WORD) + this->_i_offset - x._i_offset);
+			}
+
+			bool	operator== (const bitIteratorBase &x) const { return (this->_i_word == x._i_word && this->_i_offset == x._i_offset); }
+			bool	operator!= (const bitIteratorBase &x) const { return (!(*this == x)); }
+			bool	operator< (const bitIteratorBase &x) const { return (*this - x < 0); }
+			bool	operator> (const bitIteratorBase &x) const { return (x < *this); }
+			bool	operator<= (const bitIteratorBase &x) const { return (!(x < *this)); }
+			bool	operator>= (const bitIteratorBase &x) const { return (!(*this < x)); }
+	};
+
+	class	bitIterator: public bitIteratorBase
+	{
+		public:
+			typedef	bool							value_type;
+			typedef	bitReference					reference;
+			typedef	bool							const_reference;
+			typedef	bitReference					*pointer;
+			typedef	std::ptrdiff_t					difference_type;
+			typedef	std::random_access_iterator_tag	iterator_category;
+
+			bitIterator (void): bitIteratorBase(NULL, 0) {}
+			bitIterator (bit_word *word, unsigned int offset): bitIteratorBase(word, offset) {}
+
+			reference	operator* (void) const { return (reference(this->_i_word, static_cast<bit_word>(1) << this->_i_offset)); }
+			reference	operator[] (difference_type n) const { return (*(*this + n)); }
+
+			bitIterator	&operator++ (void) { increment(); return (*this); }
+			bitIterator	&operator-- (void) { decrement(); return (*this); }
+			bitIterator	operator++ (int) { bitIterator tmp(*this); increment(); return (tmp); }
+			bitIterator	operator-- (int) { bitIterator tmp(*this); decrement(); return (tmp); }
+			bitIterator	&operator+= (difference_type n) { advance(n); return (*this); }
+			bitIterator	&operator-= (difference_type n) { advance(-n); return (*this); }
+			bitIterator	operator+ (difference_type n) const { bitIterator tmp(*this); return (tmp += n); }
+			bitIterator	operator- (difference_type n) const { bitIterator tmp(*this); return (tmp -= n); }
+			difference_type	operator- (const bitIteratorBase &x) const { return (bitIteratorBase::operator-(x)); }
+
+			friend class	bitConstIterator;
+	};
+
+	class	bitConstIterator: public bitIteratorBase
+	{
+		public:
+			typedef	bool							value_type;
+			typedef	bool							reference;
+			typedef	bool							const_reference;
+			typedef	const bool						*pointer;
+			typedef	std::ptrdiff_t					difference_type;
+			typedef	std::random_access_iterator_tag	iterator_category;
+
+			bitConstIterator (void): bitIteratorBase(NULL, 0) {}
+			bitConstIterator (const bit_word *word, unsigned int offset): bitIteratorBase(const_cast<bit_word *>(word), offset) {}
+			bitConstIterator (const bitIterator &it): bitIteratorBase(it._i_word, it._i_offset) {}
+
+			reference	operator* (void) const { return (((*this->_i_word >> this->_i_offset) & 1) != 0); }
+			reference	operator[] (difference_type n) const { return (*(*this + n)); }
+
+			bitConstIterator	&operator++ (void) { increment(); return (*this); }
+			bitConstIterator	&operator-- (void) { decrement(); return (*this); }
+			bitConstIterator	operator++ (int) { bitConstIterator tmp(*this); increment(); return (tmp); }
+			bitConstIterator	operator-- (int) { bitConstIterator tmp(*this); decrement(); return (tmp); }
+			bitConstIterator	&operator+= (difference_type n) { advance(n); return (*this); }
+			bitConstIterator	&operator-= (difference_type n) { advance(-n); return (*this); }
+			bitConstIterator	operator+ (difference_type n) const { bitConstIterator tmp(*this); return (tmp += n); }
+			bitConstIterator	operator- (difference_type n) const { bitConstIterator tmp(*this); return (tmp -= n); }
+			difference_type		operator- (const bitIteratorBase &x) const { return (bitIteratorBase::operator-(x)); }
+	};
+
+	inline bitIterator		operator+ (std::ptrdiff_t n, const bitIterator &it) { return (it + n); }
+	inline bitConstIterator	operator+ (std::ptrdiff_t n, const bitConstIterator &it) { return (it + n); }
+
+	/**
+	 * Vector of bool packed one bit per element.
+	 *
+	 * Elements are reached through bitReference proxies. The bits past size() in the
+	 * storage are always zero, so whole words can be counted, compared and combined
+	 * without masking: count(), find_first()/find_next() and the &=, |= and ^= operators
+	 * work a word (or a SIMD register) at a time.
+	 */
+	template < class Alloc, class Growth >
+	class	vector<bool, Alloc, Growth>
+	{
+		public:
+			typedef	bool											value_type;
+			typedef	Alloc											allocator_type;
+			typedef	bitReference									reference;
+			typedef	bool											const_reference;
+			typedef	bitReference									*pointer;
+			typedef	const bool										*const_pointer;
+			typedef	bitIterator										iterator;
+			typedef	bitConstIterator								const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef	ptrdiff_t										difference_type;
+			typedef	size_t											size_type;
+			typedef	Growth											growth_policy;
+
+		protected:
+			typedef typename Alloc::template rebind<bit_word>::other	word_allocator;
+
+			bit_word		*_c_container;
+			word_allocator	_c_allocator;
+			size_type		_c_size;
+			size_type		_c_capacity;
+
+		private:
+			static size_type	wordsFor (size_type bits) { return ((bits + BIT_WORD - 1) / BIT_WORD); }
+			static bit_word		bitMask (size_type i) { return (static_cast<bit_word>(1) << (i % BIT_WORD)); }
+			//mask of the bits below i in their word
+			static bit_word		lowMask (size_type i) { return (bitMask(i) - 1); }
+
+			bool	getBit (size_type i) const { return ((this->_c_container[i / BIT_WORD] & bitMask(i)) != 0); }
+
+			void	setBit (size_type i, bool val)
+			{
+				if (val)
+					this->_c_container[i / BIT_WORD] |= bitMask(i);
+				else
+					this->_c_container[i / BIT_WORD] &= ~bitMask(i);
+			}
+
+			/**
+			 * Sets the bits [first, last) to val, whole words at a time.
+			 */
+			void	fillBits (size_type first, size_type last, bool val)
+			{
+				size_type	w = first / BIT_WORD;
+				size_type	end = last / BIT_WORD;
+				bit_word	fill = val ? ~static_cast<bit_word>(0) : 0;
+				bit_word	mask;
+
+				if (first >= last)
+					return ;
+				if (w == end)
+				{
+					mask = ~lowMask(first) & lowMask(last);
+					this->_c_container[w] = (this->_c_container[w] & ~mask) | (fill & mask);
+					return ;
+				}
+				mask = ~lowMask(first);
+				this->_c_container[w] = (this->_c_container[w] & ~mask) | (fill & mask);
+				for (w++; w < end; w++)
+					this->_c_container[w] = fill;
+				if (last % BIT_WORD != 0)
+					this->_c_container[end] = (this->_c_container[end] & ~lowMask(last)) | (fill & lowMask(last));
+			}
+
+			/**
+			 * Moves n bits from src to dst, bit by bit. The two ranges may overlap.
+			 */
+			void	moveBits (size_type dst, size_type src, size_type n)
+			{
+				if (dst < src)
+					for (size_type i = 0; i < n; i++)
+						setBit(dst + i, getBit(src + i));
+				else if (dst > src)
+					for (size_type i = n; i > 0; i--)
+						setBit(dst + i - 1, getBit(src + i - 1));
+			}
+
+			size_type	more_capacity (size_type bits)
+			{
+				size_type	words = wordsFor(bits);
+				size_type	next = Growth::grow(this->_c_capacity, words, sizeof(bit_word));
+
+				return (next < words ? words : next);
+			}
+
+			/**
+			 * Moves the bits to a new storage of words words, whose unused bits are zero.
+			 */
+			void	realloc (size_type words)
+			{
+				bit_word	*tmp = this->_c_allocator.allocate(words);
+				size_type	used = wordsFor(this->_c_size);
+
+				if (used > 0)
+					std::memcpy(tmp, this->_c_container, used * sizeof(bit_word));
+				std::memset(tmp + used, 0, (words - used) * sizeof(bit_word));
+				if (this->_c_capacity > 0)
+					this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = tmp;
+				this->_c_capacity = words;
+			}
+
+			/**
+			 * Makes room for n bits at pos, which are left with unspecified values.
+			 */
+			void	openGap (size_type pos, size_type n)
+			{
+				if (n == 0)
+					return ;
+				if (this->_c_size + n > capacity())
+					realloc(more_capacity(this->_c_size + n));
+				moveBits(pos + n, pos, this->_c_size - pos);
+				this->_c_size += n;
+			}
+
+			/**
+			 * Changes the size to n, zeroing the bits dropped past the end.
+			 */
+			void	truncate (size_type n)
+			{
+				fillBits(n, this->_c_size, false);
+				this->_c_size = n;
+			}
+
+			template <class InputIterator>
+			void	assignRange (InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				clear();
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			template <class ForwardIterator>
+			void	assignRange (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = 0;
+
+				for (ForwardIterator it = first; it != last; ++it)
+					n++;
+				clear();
+				reserve(n);
+				for (size_type i = 0; i < n; i++, ++first)
+					setBit(i, *first);
+				this->_c_size = n;
+			}
+
+			template <class InputIterator>
+			void	insertRange (size_type pos, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					insert(begin() + pos++, *first);
+			}
+
+			template <class ForwardIterator>
+			void	insertRange (size_type pos, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n = 0;
+
+				for (ForwardIterator it = first; it != last; ++it)
+					n++;
+				openGap(pos, n);
+				for (size_type i = 0; i < n; i++, ++first)
+					setBit(pos + i, *first);
+			}
+
+			template <int Op>
+			vector	&combine (const vector &x)
+			{
+				size_type	words = wordsFor(this->_c_size < x._c_size ? this->_c_size : x._c_size);
+
+				ft::simd::logical<Op>::apply(this->_c_container, x._c_container, words);
+				//bits past the end of x were zero: clear what they left behind past the end of *this
+				fillBits(this->_c_size, wordsFor(this->_c_size) * BIT_WORD, false);
+				return (*this);
+			}
+
+		public:
+
+		/**
+		 * Empty container constructor
+		 *
+		 * @param alloc : Allocator object
+		 */
+		explicit	vector (const allocator_type& alloc = allocator_type()):
+			_c_container(NULL), _c_allocator(alloc), _c_size(0), _c_capacity(0) {}
+
+		/**
+		 * Fill constructor
+		 *
+		 * @param n : Initial container size
+		 * @param val : Value to fill the container with
+		 * @param alloc : Allocator object
+		 */
+		explicit	vector (size_type n, const bool& val = false, const allocator_type& alloc = allocator_type()):
+			_c_container(NULL), _c_allocator(alloc), _c_size(0), _c_capacity(0)
+		{
+			assign(n, val);
+		}
+
+		/**
+		 * Range constructor.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a range.
+		 * @alloc : Allocator object.
+		 */
+		template <class InputIterator>
+		vector (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last, const allocator_type& alloc = allocator_type()):
+			_c_container(NULL), _c_allocator(alloc), _c_size(0), _c_capacity(0)
+		{
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @x : Another vector object of the same type.
+		 */
+		vector (const vector& x): _c_container(NULL), _c_allocator(x._c_allocator), _c_size(0), _c_capacity(0)
+		{
+			*this = x;
+		}
+
+		/**
+		 * Destructor of the container
+		 */
+		~vector (void)
+		{
+			if (this->_c_capacity > 0)
+				this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+		}
+
+		/**
+		 * Copy assignment: the storage is reused when it is large enough.
+		 */
+		vector& operator= (const vector& x)
+		{
+			size_type	words = wordsFor(x._c_size);
+
+			if (this == &x)
+				return (*this);
+			clear();
+			if (words > this->_c_capacity)
+				realloc(words);
+			if (words > 0)
+				std::memcpy(this->_c_container, x._c_container, words * sizeof(bit_word));
+			this->_c_size = x._c_size;
+			return (*this);
+		}
+
+	//ITERATORS
+
+		iterator				begin (void) { return (iterator(this->_c_container, 0)); }
+		const_iterator			begin (void) const { return (const_iterator(this->_c_container, 0)); }
+		iterator				end (void) { return (begin() + this->_c_size); }
+		const_iterator			end (void) const { return (begin() + this->_c_size); }
+		reverse_iterator		rbegin (void) { return (reverse_iterator(end())); }
+		const_reverse_iterator	rbegin (void) const { return (const_reverse_iterator(end())); }
+		reverse_iterator		rend (void) { return (reverse_iterator(begin())); }
+		const_reverse_iterator	rend (void) const { return (const_reverse_iterator(begin())); }
+
+	//CAPACITY METHODS
+
+		size_type	size (void) const { return (this->_c_size); }
+		size_type	capacity (void) const { return (this->_c_capacity * BIT_WORD); }
+		bool		empty (void) const { return (this->_c_size == 0); }
+
+		size_type	max_size (void) const
+		{
+			size_type	words = this->_c_allocator.max_size();
+
+			return (words > static_cast<size_type>(-1) / BIT_WORD ? static_cast<size_type>(-1) : words * BIT_WORD);
+		}
+
+		/**
+		 * Change size.
+		 *
+		 * @param n : New container size, expressed in number of elements.
+		 * @param val : Value of the added elements.
+		 */
+		void resize (size_type n, bool val = false)
+		{
+			if (n < this->_c_size)
+				truncate(n);
+			else
+				insert(end(), n - this->_c_size, val);
+		}
+
+		/**
+		 * Request a change in capacity.
+		 *
+		 * @n : Minimum capacity for the vector, in elements.
+		 */
+		void reserve (size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("vector::reserve");
+			if (wordsFor(n) > this->_c_capacity)
+				realloc(wordsFor(n));
+		}
+
+		/**
+		 * Reduces the storage to the words holding the elements.
+		 */
+		void shrink_to_fit (void)
+		{
+			size_type	words = wordsFor(this->_c_size);
+
+			if (words == this->_c_capacity)
+				return ;
+			if (words > 0)
+				realloc(words);
+			else
+			{
+				this->_c_allocator.deallocate(this->_c_container, this->_c_capacity);
+				this->_c_container = NULL;
+				this->_c_capacity = 0;
+			}
+		}
+
+		/**
+		 * Memory footprint.
+		 *
+		 * @return : the number of bytes of storage held by the vector.
+		 */
+		size_type memory_usage (void) const { return (this->_c_capacity * sizeof(bit_word)); }
+
+	//ELEMENT ACCESS METHODS
+
+		reference		operator[] (size_type n) { return (reference(this->_c_container + n / BIT_WORD, bitMask(n))); }
+		const_reference	operator[] (size_type n) const { return (getBit(n)); }
+
+		reference at (size_type n)
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("vector::at");
+			return ((*this)[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= this->_c_size)
+				throw std::out_of_range("vector::at");
+			return (getBit(n));
+		}
+
+		reference		front (void) { return ((*this)[0]); }
+		const_reference	front (void) const { return (getBit(0)); }
+		reference		back (void) { return ((*this)[this->_c_size - 1]); }
+		const_reference	back (void) const { return (getBit(this->_c_size - 1)); }
+
+	//BIT OPERATIONS
+
+		/**
+		 * Number of elements set to true, counted a word at a time.
+		 */
+		size_type count (void) const
+		{
+			return (ft::simd::popcount(this->_c_container, wordsFor(this->_c_size)));
+		}
+
+		/**
+		 * Number of elements equal to val.
+		 */
+		size_type count (bool val) const
+		{
+			return (val ? count() : this->_c_size - count());
+		}
+
+		/**
+		 * Index of the first element set to true, or size() if there is none.
+		 */
+		size_type find_first (void) const
+		{
+			size_type	words = wordsFor(this->_c_size);
+
+			for (size_type w = 0; w < words; w++)
+				if (this->_c_container[w] != 0)
+					return (w * BIT_WORD + __builtin_ctzl(this->_c_container[w]));
+			return (this->_c_size);
+		}
+
+		/**
+		 * Index of the first element set to true after pos, or size() if there is none.
+		 *
+		 * @pos : the index to search from, excluded.
+		 */
+		size_type find_next (size_type pos) const
+		{
+			size_type	words = wordsFor(this->_c_size);
+			size_type	w;
+			bit_word	bits;
+
+			if (++pos >= this->_c_size)
+				return (this->_c_size);
+			w = pos / BIT_WORD;
+			bits = this->_c_container[w] & ~lowMask(pos);
+			while (bits == 0)
+			{
+				if (++w == words)
+					return (this->_c_size);
+				bits = this->_c_container[w];
+			}
+			return (w * BIT_WORD + __builtin_ctzl(bits));
+		}
+
+		/**
+		 * Flips every element.
+		 */
+		void flip (void)
+		{
+			size_type	words = wordsFor(this->_c_size);
+
+			for (size_type w = 0; w < words; w++)
+				this->_c_container[w] = ~this->_c_container[w];
+			fillBits(this->_c_size, words * BIT_WORD, false);
+		}
+
+		/**
+		 * Bulk logical operations with x, element by element.
+		 *
+		 * Elements past the end of x are taken as false; the size does not change.
+		 */
+		vector	&operator&= (const vector &x)
+		{
+			if (x._c_size < this->_c_size)
+				fillBits(x._c_size, this->_c_size, false);
+			return (combine<ft::simd::logic_and>(x));
+		}
+
+		vector	&operator|= (const vector &x) { return (combine<ft::simd::logic_or>(x)); }
+		vector	&operator^= (const vector &x) { return (combine<ft::simd::logic_xor>(x)); }
+
+	//MODIFIERS METHODS
+
+		/**
+		 * Assign : Fill version
+		 *
+		 * @param n : New size for the container
+		 * @param val : Value to fill the container with.
+		 */
+		void assign (size_type n, const bool& val)
+		{
+			bool	copy = val;
+
+			clear();
+			reserve(n);
+			fillBits(0, n, copy);
+			this->_c_size = n;
+		}
+
+		/**
+		 * Assign : Range version.
+		 *
+		 * @first/@last : Input iterators to the initial and final positions in a sequence.
+		 */
+		template <class InputIterator>
+		void assign (InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			assignRange(first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		void push_back (const bool& val)
+		{
+			if (this->_c_size == capacity())
+				realloc(more_capacity(this->_c_size + 1));
+			if (val)
+				this->_c_container[this->_c_size / BIT_WORD] |= bitMask(this->_c_size);
+			this->_c_size++;
+		}
+
+		void pop_back (void)
+		{
+			if (this->_c_size > 0)
+				truncate(this->_c_size - 1);
+		}
+
+		iterator insert (iterator position, const bool& val)
+		{
+			size_type	pos = position - begin();
+			bool		copy = val;
+
+			openGap(pos, 1);
+			setBit(pos, copy);
+			return (begin() + pos);
+		}
+
+		void insert (iterator position, size_type n, const bool& val)
+		{
+			size_type	pos = position - begin();
+			bool		copy = val;
+
+			openGap(pos, n);
+			fillBits(pos, pos + n, copy);
+		}
+
+		template <class InputIterator>
+		void insert (iterator position, InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+		{
+			insertRange(position - begin(), first, last, typename ft::iterator_category<InputIterator>::type());
+		}
+
+		iterator erase (iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator erase (iterator first, iterator last)
+		{
+			size_type	pos = first - begin();
+			size_type	n = last - first;
+
+			moveBits(pos, pos + n, this->_c_size - pos - n);
+			truncate(this->_c_size - n);
+			return (begin() + pos);
+		}
+
+		void swap (vector& x)
+		{
+			bit_word	*tmp = x._c_container;
+			size_type	size = x._c_size;
+			size_type	cap = x._c_capacity;
+
+			x._c_container = this->_c_container;
+			x._c_size = this->_c_size;
+			x._c_capacity = this->_c_capacity;
+			this->_c_container = tmp;
+			this->_c_size = size;
+			this->_c_capacity = cap;
+		}
+
+		/**
+		 * Swaps the values of two elements.
+		 */
+		static void swap (reference a, reference b)
+		{
+			bool	tmp = a;
+
+			a = b;
+			b = tmp;
+		}
+
+		void clear (void)
+		{
+			truncate(0);
+		}
+
+		allocator_type get_allocator (void) const
+		{
+			return (allocator_type(this->_c_allocator));
+		}
+
+		/**
+		 * Relational operators, comparing whole words.
+		 */
+		bool operator== (const vector& rhs) const
+		{
+			size_type	words = wordsFor(this->_c_size);
+
+			return (this->_c_size == rhs._c_size && (words == 0 || std::memcmp(this->_c_container, rhs._c_container, words * sizeof(bit_word)) == 0));
+		}
+
+		bool operator< (const vector& rhs) const
+		{
+			size_type	n = this->_c_size < rhs._c_size ? this->_c_size : rhs._c_size;
+			bit_word	diff;
+
+			for (size_type w = 0; w * BIT_WORD < n; w++)
+			{
+				diff = this->_c_container[w] ^ rhs._c_container[w];
+				if (w == n / BIT_WORD)
+					diff &= lowMask(n);
+				if (diff != 0)
+					return ((rhs._c_container[w] & (diff & -diff)) != 0);
+			}
+			return (this->_c_size < rhs._c_size);
+		}
+
+		bool operator!= (const vector& rhs) const { return (!(*this == rhs)); }
+		bool operator> (const vector& rhs) const { return (rhs < *this); }
+		bool operator<= (const vector& rhs) const { return (!(rhs < *this)); }
+		bool operator>= (const vector& rhs) const { return (!(*this < rhs)); }
+	};
+}
+
+#endif
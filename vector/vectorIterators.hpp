@@ -2,6 +2,7 @@
 # define VECTORITERATORS_HPP
 # include <iostream>
 # include "../reverse_iterator.hpp"
+# include <iterator>
 
 namespace	ft
 {
@@ -18,6 +19,7 @@ namespace	ft
 			typedef	T					*pointer;
 			typedef	T	const			*const_pointer;
 			typedef	std::ptrdiff_t		difference_type;
+			typedef	std::random_access_iterator_tag	iterator_category;
 		private:
 			pointer	_i_container;
 
@@ -100,7 +102,7 @@ namespace	ft
 			 *
 			 * @return : the value of the dereferenced container.
 			 */
-			value_type	operator[] (size_t n) const { return (_i_container[n]); }
+			reference	operator[] (size_t n) const { return (_i_container[n]); }
 
 			/**
 			 * Dereference operator.
@@ -114,7 +116,7 @@ namespace	ft
 			 *
 			 * @return : the value of the dereferenced container.
 			 */
-			value_type	operator-> (void) const { return (_i_container); }
+			pointer		operator-> (void) const { return (_i_container); }
 
 			/**
 			 * Equality operator.
@@ -163,14 +165,14 @@ namespace	ft
 			 *
 			 * @n : the value to add.
 			 */
-			vectorIterator<T> &operator+= (int n) { _i_container = _i_container + n; return (*this); }
+			vectorIterator<T> &operator+= (difference_type n) { _i_container = _i_container + n; return (*this); }
 
 			/**
 			 * Decrementation operator.
 			 *
 			 * @n : the value to substract.
 			 */
-			vectorIterator<T> &operator-= (int n) { _i_container -= n; return (*this); }
+			vectorIterator<T> &operator-= (difference_type n) { _i_container -= n; return (*this); }
 
 			/**
 			 * Incrementation operator.
@@ -216,7 +218,7 @@ namespace	ft
 			 * @param n : number to add.
 			 * @return : increased vectorIterator<T>.
 			 */
-			vectorIterator<T> operator+ (int n)
+			vectorIterator<T> operator+ (difference_type n)
 			{
 				vectorIterator<T>	it(*this);
 
@@ -230,13 +232,24 @@ namespace	ft
 			 * @param n : number to substract.
 			 * @return : substracted vectorIterator<T>.
 			 */
-			vectorIterator<T> operator- (int n)
+			vectorIterator<T> operator- (difference_type n)
 			{
 				vectorIterator<T>	it(*this);
 
 				it._i_container -= n;
 				return (it);
 			}
+
+			/**
+			 * Difference operator.
+			 *
+			 * @param it : an iterator on the same container.
+			 * @return : the number of elements between it and this iterator.
+			 */
+			difference_type operator- (const vectorIterator<T> &it) const
+			{
+				return (_i_container - it._i_container);
+			}
 	};
 
 		template <typename T>
@@ -249,6 +262,7 @@ namespace	ft
 				typedef	T					*pointer;
 				typedef	T	const			*const_pointer;
 				typedef	std::ptrdiff_t		difference_type;
+				typedef	std::random_access_iterator_tag	iterator_category;
 			private:
 				pointer	_i_container;
 
@@ -335,7 +349,7 @@ namespace	ft
 				 *
 				 * @return : the value of the dereferenced container.
 				 */
-				value_type	operator[] (size_t n) const { return (_i_container[n]); }
+				const_reference	operator[] (size_t n) const { return (_i_container[n]); }
 
 				/**
 				 * Dereference operator.
@@ -349,7 +363,7 @@ namespace	ft
 				 *
 				 * @return : the value of the dereferenced container.
 				 */
-				value_type	operator-> (void) const { return (_i_container); }
+				const_pointer	operator-> (void) const { return (_i_container); }
 
 				/**
 				 * Equality operator.
@@ -384,7 +398,7 @@ namespace	ft
 				 *
 				 * @return : true if the A <= B, otherwise it returns false.
 				 */
-				bool	operator<= (const vectorConstIterator<T> &it) const { return (it._i_container <= it._i_container); }
+				bool	operator<= (const vectorConstIterator<T> &it) const { return (_i_container <= it._i_container); }
 
 				/**
 				 * Comparison operator.
@@ -437,7 +451,7 @@ namespace	ft
 				 * @param n : number to add.
 				 * @return : increased vectorIterator<T>.
 				 */
-				vectorConstIterator<T> operator+ (int n)
+				vectorConstIterator<T> operator+ (difference_type n)
 				{
 					vectorConstIterator<T>	it(*this);
 
@@ -451,13 +465,24 @@ namespace	ft
 				 * @param n : number to substract.
 				 * @return : substracted vectorIterator<T>.
 				 */
-				vectorConstIterator<T> operator- (int n)
+				vectorConstIterator<T> operator- (difference_type n)
 				{
 					vectorConstIterator<T>	it(*this);
 
 					it._i_container -= n;
 					return (it);
 				}
+
+				/**
+				 * Difference operator.
+				 *
+				 * @param it : an iterator on the same container.
+				 * @return : the number of elements between it and this iterator.
+				 */
+				difference_type operator- (const vectorConstIterator<T> &it) const
+				{
+					return (_i_container - it._i_container);
+				}
 		};
 		
 }
@@ -0,0 +1,322 @@
+#ifndef VECTORSTORAGE_HPP
+# define VECTORSTORAGE_HPP
+# include "vectorIterators.hpp"
+# include "../utils.hpp"
+# include "simd.hpp"
+# include <cstddef>
+# include <cstring>
+# include <iterator>
+# if FT_CXX11
+#  include <type_traits>
+# endif
+
+/**
+ * Storage helpers shared by ft::vector, ft::small_vector and ft::static_vector.
+ *
+ * They work on a raw array of elements, constructing and destroying them through the
+ * allocator of the container, so that each container only keeps what is specific to
+ * where its elements live.
+ */
+namespace ft
+{
+	/**
+	 * The capacity to grow to when needed elements do not fit, according to the growth policy.
+	 *
+	 * @capacity : the current capacity.
+	 * @needed : the number of elements the storage must hold.
+	 * @max : the maximum capacity (the max_size() of the container).
+	 */
+	template <class Growth>
+	size_t	growCapacity (size_t capacity, size_t needed, size_t max, size_t element_size)
+	{
+		size_t	grown = Growth::grow(capacity, needed, element_size);
+
+		if (grown > max)
+			grown = needed > max ? needed : max;
+		return (grown);
+	}
+
+	/**
+	 * Whether moving elements to other storage cannot throw: they are moved bytewise,
+	 * or (in C++11) by a noexcept move constructor.
+	 */
+	template <class T>
+	struct	relocatesNothrow
+	{
+# if FT_CXX11
+		static const bool	value = ft::is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value;
+# else
+		static const bool	value = ft::is_trivially_relocatable<T>::value;
+# endif
+	};
+
+	/**
+	 * Destroys the n elements at p.
+	 */
+	template <class Alloc, class T>
+	void	destroyRange (Alloc &alloc, T *p, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			alloc.destroy(p + i);
+	}
+
+	/**
+	 * Copies n elements from src to the uninitialized storage at dst.
+	 *
+	 * Trivially copyable types are copied with a single memcpy. If a copy throws,
+	 * the elements already built are destroyed: dst is left uninitialized.
+	 */
+	template <class Alloc, class T>
+	void	copyConstruct (Alloc &alloc, T *dst, const T *src, size_t n)
+	{
+		size_t	i = 0;
+
+		if (n == 0)
+			return ;
+		if (ft::is_trivially_copyable<T>::value)
+		{
+			std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(T));
+			return ;
+		}
+		try
+		{
+			for (; i < n; i++)
+				alloc.construct(dst + i, src[i]);
+		}
+		catch (...)
+		{
+			destroyRange(alloc, dst, i);
+			throw ;
+		}
+	}
+
+	/**
+	 * Moves (in C++11, when the move cannot throw) or copies n elements from src to the
+	 * uninitialized storage at dst. The elements at src are left alive, and if a copy
+	 * throws, the elements already built are destroyed.
+	 */
+	template <class Alloc, class T>
+	void	moveConstruct (Alloc &alloc, T *dst, T *src, size_t n)
+	{
+		size_t	i = 0;
+
+		try
+		{
+			for (; i < n; i++)
+				alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(src[i]));
+		}
+		catch (...)
+		{
+			destroyRange(alloc, dst, i);
+			throw ;
+		}
+	}
+
+	/**
+	 * Constructs n copies of val in the uninitialized storage at dst.
+	 *
+	 * Trivially copyable values are stored with a single memset when all their bytes are
+	 * the same (zeroes, -1...), otherwise with fixed-size copies the compiler turns into
+	 * plain (vectorizable) stores. If a copy throws, the elements already built are destroyed.
+	 */
+	template <class Alloc, class T>
+	void	fillConstruct (Alloc &alloc, T *dst, size_t n, const T &val)
+	{
+		const unsigned char	*bytes = reinterpret_cast<const unsigned char *>(&val);
+		size_t				same = 1;
+		size_t				i = 0;
+
+		if (n == 0)
+			return ;
+		if (ft::is_trivially_copyable<T>::value)
+		{
+			while (same < sizeof(T) && bytes[same] == bytes[0])
+				same++;
+			if (same == sizeof(T))
+				std::memset(static_cast<void *>(dst), bytes[0], n * sizeof(T));
+			else
+				for (size_t i = 0; i < n; i++)
+					std::memcpy(static_cast<void *>(dst + i), static_cast<const void *>(&val), sizeof(T));
+		}
+		else
+		{
+			try
+			{
+				for (; i < n; i++)
+					alloc.construct(dst + i, val);
+			}
+			catch (...)
+			{
+				destroyRange(alloc, dst, i);
+				throw ;
+			}
+		}
+	}
+
+	/**
+	 * Copies the n elements of the range starting at first to the uninitialized storage at dst.
+	 *
+	 * Contiguous ranges of the same type go through copyConstruct(). If a copy throws,
+	 * the elements already built are destroyed.
+	 */
+	template <class Alloc, class T, class InputIterator>
+	void	copyRange (Alloc &alloc, T *dst, InputIterator first, size_t n)
+	{
+		size_t	i = 0;
+
+		try
+		{
+			for (; i < n; i++)
+				alloc.construct(dst + i, *first++);
+		}
+		catch (...)
+		{
+			destroyRange(alloc, dst, i);
+			throw ;
+		}
+	}
+
+	template <class Alloc, class T>
+	void	copyRange (Alloc &alloc, T *dst, T *first, size_t n) { copyConstruct(alloc, dst, first, n); }
+
+	template <class Alloc, class T>
+	void	copyRange (Alloc &alloc, T *dst, const T *first, size_t n) { copyConstruct(alloc, dst, first, n); }
+
+	template <class Alloc, class T>
+	void	copyRange (Alloc &alloc, T *dst, vectorIterator<T> first, size_t n) { copyConstruct(alloc, dst, &*first, n); }
+
+	template <class Alloc, class T>
+	void	copyRange (Alloc &alloc, T *dst, vectorConstIterator<T> first, size_t n) { copyConstruct(alloc, dst, &*first, n); }
+
+	/**
+	 * Moves n elements from src to the uninitialized storage at dst, the storage at src
+	 * is left uninitialized.
+	 *
+	 * Trivially relocatable types are moved with a single memmove. Other types are all
+	 * built at dst before any element of src is destroyed: if a copy throws, src is left
+	 * as it was. The two ranges may overlap, but then the elements are moved one by one,
+	 * which is only safe when relocatesNothrow holds.
+	 */
+	template <class Alloc, class T>
+	void	relocate (Alloc &alloc, T *dst, T *src, size_t n)
+	{
+		if (n == 0 || dst == src)
+			return ;
+		if (ft::is_trivially_relocatable<T>::value)
+			std::memmove(static_cast<void *>(dst), static_cast<void *>(src), n * sizeof(T));
+		else if (dst + n <= src || src + n <= dst)
+		{
+			moveConstruct(alloc, dst, src, n);
+			destroyRange(alloc, src, n);
+		}
+		else if (dst < src)
+			for (size_t i = 0; i < n; i++)
+			{
+				alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(src[i]));
+				alloc.destroy(src + i);
+			}
+		else
+			for (size_t i = n; i > 0; i--)
+			{
+				alloc.construct(dst + i - 1, FT_MOVE_IF_NOEXCEPT(src[i - 1]));
+				alloc.destroy(src + i - 1);
+			}
+	}
+
+	/**
+	 * Builders of the n elements an insertion constructs at dst: copies of a range, or of a value.
+	 * Like copyRange() and fillConstruct(), they leave dst uninitialized when they throw.
+	 */
+	template <class InputIterator>
+	struct	rangeFill
+	{
+		InputIterator	first;
+
+		explicit rangeFill (InputIterator f): first(f) {}
+
+		template <class Alloc, class T>
+		void	operator() (Alloc &alloc, T *dst, size_t n) const { copyRange(alloc, dst, this->first, n); }
+	};
+
+	template <class T>
+	struct	valueFill
+	{
+		const T	&val;
+
+		explicit valueFill (const T &v): val(v) {}
+
+		template <class Alloc>
+		void	operator() (Alloc &alloc, T *dst, size_t n) const { fillConstruct(alloc, dst, n, this->val); }
+	};
+
+# if FT_CXX11
+	//a single element, moved from val
+	template <class T>
+	struct	moveFill
+	{
+		T	&val;
+
+		explicit moveFill (T &v): val(v) {}
+
+		template <class Alloc>
+		void	operator() (Alloc &alloc, T *dst, size_t) const { alloc.construct(dst, FT_MOVE(this->val)); }
+	};
+# endif
+
+	/**
+	 * Destroys the n elements at index pos of data[0, size), then moves the following
+	 * elements down in a single pass. The size is left to the caller to decrease.
+	 */
+	template <class Alloc, class T>
+	void	eraseGap (Alloc &alloc, T *data, size_t size, size_t pos, size_t n)
+	{
+		destroyRange(alloc, data + pos, n);
+		relocate(alloc, data + pos, data + pos + n, size - pos - n);
+	}
+
+	/**
+	 * Length of a range, measured without consuming it: in constant time for
+	 * random access iterators, in one walk for the other forward iterators.
+	 */
+	template <class ForwardIterator>
+	size_t	rangeLength (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+	{
+		size_t	n = 0;
+
+		for (; first != last; ++first)
+			n++;
+		return (n);
+	}
+
+	template <class RandomIterator>
+	size_t	rangeLength (RandomIterator first, RandomIterator last, std::random_access_iterator_tag)
+	{
+		return (static_cast<size_t>(last - first));
+	}
+
+	/**
+	 * Equality of two arrays, compared with ft::simd::equal.
+	 */
+	template <class T>
+	bool	storageEqual (const T *a, size_t na, const T *b, size_t nb)
+	{
+		return (na == nb && ft::simd::equal(a, b, na));
+	}
+
+	/**
+	 * Lexicographical order of two arrays: the first mismatch is found with ft::simd::mismatch,
+	 * then compared with operator<.
+	 */
+	template <class T>
+	bool	storageLess (const T *a, size_t na, const T *b, size_t nb)
+	{
+		size_t	n = na < nb ? na : nb;
+		size_t	i = ft::simd::mismatch(a, b, n);
+
+		if (i < n)
+			return (a[i] < b[i]);
+		return (na < nb);
+	}
+}
+
+#endif